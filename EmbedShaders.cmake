@@ -0,0 +1,43 @@
+# LLGL Example ImGui
+# Created on 02/22/2025 by L.Hermanns
+# Licensed under the BSD-3 Clause License
+
+# Generates a C++ source file that defines the table 'g_embeddedShaders' (see sources/EmbeddedShaders.h)
+# with the contents of the specified shader files as constant arrays. Runs in script mode:
+#   cmake -DSHADER_FILES=<file1>|<file2>|... -DOUTPUT_FILE=<file.cpp> -P EmbedShaders.cmake
+# The files are separated by '|' since a ';' would split the argument of the custom command.
+
+string(REPLACE "|" ";" SHADER_FILES "${SHADER_FILES}")
+
+# CMake regular expressions have no repetition count, so the pattern for a line of 16 bytes is spelled out
+set(SHADER_LINE_PATTERN "")
+foreach(BYTE_INDEX RANGE 1 16)
+    string(APPEND SHADER_LINE_PATTERN "0x[0-9a-f][0-9a-f],")
+endforeach()
+
+set(SHADER_ARRAYS "")
+set(SHADER_TABLE "")
+set(SHADER_INDEX 0)
+
+foreach(SHADER_FILE ${SHADER_FILES})
+    get_filename_component(SHADER_NAME "${SHADER_FILE}" NAME)
+    file(READ "${SHADER_FILE}" SHADER_HEX HEX)
+    string(LENGTH "${SHADER_HEX}" SHADER_HEX_LENGTH)
+    math(EXPR SHADER_SIZE "${SHADER_HEX_LENGTH} / 2")
+
+    # Append a null terminator, so text shaders can be passed as null-terminated code string
+    string(REGEX REPLACE "([0-9a-f][0-9a-f])" "0x\\1," SHADER_BYTES "${SHADER_HEX}")
+    string(REGEX REPLACE "(${SHADER_LINE_PATTERN})" "\\1\n    " SHADER_BYTES "${SHADER_BYTES}")
+
+    string(APPEND SHADER_ARRAYS "// ${SHADER_NAME}\nstatic const unsigned char g_shader${SHADER_INDEX}[] =\n{\n    ${SHADER_BYTES}0x00\n};\n\n")
+    string(APPEND SHADER_TABLE "    { \"${SHADER_NAME}\", g_shader${SHADER_INDEX}, ${SHADER_SIZE} },\n")
+
+    math(EXPR SHADER_INDEX "${SHADER_INDEX} + 1")
+endforeach()
+
+set(
+    OUTPUT_CONTENT
+    "// Generated by EmbedShaders.cmake; do not edit\n\n#include \"EmbeddedShaders.h\"\n\n\n${SHADER_ARRAYS}const EmbeddedShader g_embeddedShaders[] =\n{\n${SHADER_TABLE}    { nullptr, nullptr, 0 },\n};\n"
+)
+
+file(WRITE "${OUTPUT_FILE}" "${OUTPUT_CONTENT}")
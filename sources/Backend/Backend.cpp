@@ -9,22 +9,39 @@
 #include "Backend.h"
 #include "../Globals.h"
 #include "../Platform/Platform.h"
+#include "../MemoryTracker.h"
+#include "../JobSystem.h"
+#include "../MetricsExporter.h"
+#include "../EmbeddedShaders.h"
+#include "../StressPanel.h"
+#include "../LogSink.h"
+#include "ImGuiViewports.h"
 #include <LLGL/Utils/TypeNames.h>
 #include <LLGL/Utils/Parse.h>
 #include <LLGL/RenderSystem.h>
+#include <algorithm>
 #include <vector>
+#include <cfloat>
 #include <cstdint>
 #include <cstring>
+#include <cstdio>
 
 
 std::unique_ptr<Backend> g_backend;
 
+// Current ImGui context of each thread; see ImGuiUserConfig.h
+thread_local ImGuiContext* g_imGuiThreadContext = nullptr;
+
 using BackendRegisterMap = std::map<std::string, Backend::AllocateBackendFunc>;
 
 Backend::~Backend()
 {
+    renderThread.Stop();
+    shaderHotReload.Unwatch();
     for (WindowContext& context : windowContexts)
         context.input->Drop(context.swapChain->GetSurface());
+    for (SceneRenderPass& entry : sceneRenderPasses)
+        renderer->Release(*entry.renderPass);
 }
 
 static BackendRegisterMap& GetBackendRegisterMap()
@@ -39,13 +56,38 @@ void Backend::RegisterBackend(const char* name, AllocateBackendFunc onAllocateFu
     registeredBackends[name] = onAllocateFunc;
 }
 
-static ImGuiContext* NewImGuiContext()
+// The rendering debugger is only attached in debug builds, see CreateResources()
+static bool IsDebuggerAttached()
+{
+    #if !NDEBUG
+    return true;
+    #else
+    return false;
+    #endif
+}
+
+// Secondary ImGui viewports are rendered by ImGui on the main thread, so they require the sequential frame path
+static bool IsImGuiViewportsEnabled()
+{
+    return (options.imGuiViewports && ImGuiViewports::IsSupported());
+}
+
+static ImGuiContext* NewImGuiContext(ImGuiAllocator* allocator)
 {
+    // Route all allocations of the new context, including the context object itself, to its own allocator
+    ImGuiAllocator::Install();
+    ImGuiAllocator::SetPending(allocator);
+
     ImGuiContext* imGuiContext = ImGui::CreateContext();
+    ImGui::SetCurrentContext(imGuiContext);
     {
         ImGuiIO& io = ImGui::GetIO();
         io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;
+        io.UserData = allocator;
     }
+
+    ImGuiAllocator::SetPending(nullptr);
+
     return imGuiContext;
 }
 
@@ -84,7 +126,10 @@ static void ProcessMouseInput(Backend::WindowContext& context)
 {
     // Forward user input to ImGui
     ImGui::SetCurrentContext(context.imGuiContext);
-    ImGui::GetIO().AddMousePosEvent(static_cast<float>(context.mousePosInWindow.x), static_cast<float>(context.mousePosInWindow.y));
+
+    // With multi-viewports, mouse positions are forwarded in screen coordinates by the window the mouse moves over
+    if (!ImGuiViewports::IsEnabled())
+        ImGui::GetIO().AddMousePosEvent(static_cast<float>(context.mousePosInWindow.x), static_cast<float>(context.mousePosInWindow.y));
 
     switch (context.inputFocus)
     {
@@ -113,10 +158,52 @@ void Backend::Init()
 {
     for (WindowContext& context : windowContexts)
         InitContext(context);
+
+    if (options.imGuiViewports && !ImGuiViewports::IsSupported())
+        LLGL::Log::Errorf(LLGL::Log::ColorFlags::StdError, "ImGui multi-viewports require the docking branch of ImGui\n");
+
+    if (IsImGuiViewportsEnabled())
+    {
+        // Secondary viewports use the formats of the main swap chains, so they share the scene render pass and the PSOs of the ImGui backends
+        LLGL::SwapChainDescriptor viewportDesc;
+        {
+            viewportDesc.swapBuffers    = options.numSwapBuffers;
+            viewportDesc.resizable      = true;
+        }
+        ImGuiViewports::Get().Init(
+            viewportDesc,
+            [this](LLGL::SwapChain& swapChain, ImDrawData* drawData)
+            {
+                RecordViewport(swapChain, drawData);
+            }
+        );
+
+        for (WindowContext& context : windowContexts)
+        {
+            ImGui::SetCurrentContext(context.imGuiContext);
+            ImGuiViewports::Get().Install(*context.swapChain);
+        }
+    }
 }
 
 void Backend::Release()
 {
+    scene.simulation.StopThread();
+    StressPanel::Get().StopProducer();
+
+    // Draw data copies must be released before the ImGui contexts and allocators they were allocated from
+    renderThread.Stop();
+    for (FrameSnapshot& snapshot : frameSnapshots)
+        snapshot.windows.clear();
+
+    // Secondary viewports must be destroyed while the ImGui backends of their contexts are still alive
+    for (WindowContext& context : windowContexts)
+    {
+        ImGui::SetCurrentContext(context.imGuiContext);
+        ImGuiViewports::Get().Uninstall();
+    }
+    ImGuiViewports::Get().Release();
+
     for (WindowContext& context : windowContexts)
         ReleaseContext(context);
 }
@@ -134,6 +221,13 @@ void Backend::InitContext(WindowContext& context)
     // Connect swap-chain and ImGui context with window
     LLGL::CastTo<LLGL::Window>(context.swapChain->GetSurface()).SetUserData(&context);
 
+    // Track font atlas texture; the ImGui backends upload it as RGBA8 texture
+    ImFontAtlas* fontAtlas = ImGui::GetIO().Fonts;
+    unsigned char* fontPixels = nullptr;
+    int fontWidth = 0, fontHeight = 0;
+    fontAtlas->GetTexDataAsRGBA32(&fontPixels, &fontWidth, &fontHeight);
+    MemoryTracker::Get().TrackResource(fontAtlas, MemoryCategory::Texture, static_cast<std::uint64_t>(fontWidth) * fontHeight * 4, "ImGui.FontAtlas", context.windowIndex);
+
     lastTick = LLGL::Timer::Tick();
 }
 
@@ -143,7 +237,15 @@ void Backend::ReleaseContext(WindowContext& context)
 
     PlatformShutdown();
 
+    MemoryTracker::Get().UntrackResource(ImGui::GetIO().Fonts);
+
+    context.renderGraph.reset();
+
     ImGui::DestroyContext(context.imGuiContext);
+
+    // Release allocators only after all blocks of the context have been returned
+    context.imGuiAllocator.reset();
+    context.renderAllocator.reset();
 }
 
 void Backend::BeginFrame(WindowContext& context)
@@ -160,71 +262,15 @@ std::unique_ptr<Backend> Backend::NewBackend(const char* name)
     return (it != registeredBackends.end() ? it->second() : std::unique_ptr<Backend>{});
 }
 
-struct Vertex
-{
-    float           position[3];
-    float           normal[3];
-    std::uint32_t   color;
-};
-
-static std::vector<Vertex> GenerateMeshVertices()
-{
-    constexpr std::uint32_t col0 = 0xFFFFFFFF;
-    constexpr std::uint32_t col1 = 0xFFFFFFFF;
-    constexpr std::uint32_t col2 = 0xFFFFFFFF;
-    constexpr std::uint32_t col3 = 0xFFFFFFFF;
-
-    return
-    {
-        // front
-        Vertex{ { -1, -1, -1 }, {  0,  0, -1 }, col0 },
-        Vertex{ { -1,  1, -1 }, {  0,  0, -1 }, col1 },
-        Vertex{ {  1,  1, -1 }, {  0,  0, -1 }, col2 },
-        Vertex{ {  1, -1, -1 }, {  0,  0, -1 }, col3 },
-
-        // right
-        Vertex{ {  1, -1, -1 }, { +1,  0,  0 }, col0 },
-        Vertex{ {  1,  1, -1 }, { +1,  0,  0 }, col1 },
-        Vertex{ {  1,  1,  1 }, { +1,  0,  0 }, col2 },
-        Vertex{ {  1, -1,  1 }, { +1,  0,  0 }, col3 },
-
-        // left
-        Vertex{ { -1, -1,  1 }, { -1,  0,  0 }, col0 },
-        Vertex{ { -1,  1,  1 }, { -1,  0,  0 }, col1 },
-        Vertex{ { -1,  1, -1 }, { -1,  0,  0 }, col2 },
-        Vertex{ { -1, -1, -1 }, { -1,  0,  0 }, col3 },
-
-        // top
-        Vertex{ { -1,  1, -1 }, {  0, +1,  0 }, col0 },
-        Vertex{ { -1,  1,  1 }, {  0, +1,  0 }, col1 },
-        Vertex{ {  1,  1,  1 }, {  0, +1,  0 }, col2 },
-        Vertex{ {  1,  1, -1 }, {  0, +1,  0 }, col3 },
-
-        // bottom
-        Vertex{ { -1, -1,  1 }, {  0, -1,  0 }, col0 },
-        Vertex{ { -1, -1, -1 }, {  0, -1,  0 }, col1 },
-        Vertex{ {  1, -1, -1 }, {  0, -1,  0 }, col2 },
-        Vertex{ {  1, -1,  1 }, {  0, -1,  0 }, col3 },
-
-        // back
-        Vertex{ {  1, -1,  1 }, {  0,  0, +1 }, col0 },
-        Vertex{ {  1,  1,  1 }, {  0,  0, +1 }, col1 },
-        Vertex{ { -1,  1,  1 }, {  0,  0, +1 }, col2 },
-        Vertex{ { -1, -1,  1 }, {  0,  0, +1 }, col3 },
-    };
-}
-
-static std::vector<std::uint16_t> GenerateMeshIndices()
+static const std::vector<LLGL::VertexAttribute>& GetVertexAttribs()
 {
-    return
+    static const std::vector<LLGL::VertexAttribute> vertexAttribs =
     {
-         0,  1,  2,  0,  2,  3, // front
-         4,  5,  6,  4,  6,  7, // right
-         8,  9, 10,  8, 10, 11, // left
-        12, 13, 14, 12, 14, 15, // top
-        16, 17, 18, 16, 18, 19, // bottom
-        20, 21, 22, 20, 22, 23, // back
+        LLGL::VertexAttribute{ "position", LLGL::Format::RGB32Float, 0, offsetof(Vertex, position), sizeof(Vertex) },
+        LLGL::VertexAttribute{ "normal",   LLGL::Format::RGB32Float, 1, offsetof(Vertex, normal  ), sizeof(Vertex) },
+        LLGL::VertexAttribute{ "color",    LLGL::Format::RGBA8UNorm, 2, offsetof(Vertex, color   ), sizeof(Vertex) },
     };
+    return vertexAttribs;
 }
 
 class WindowEventListener final : public LLGL::Window::EventListener
@@ -264,16 +310,68 @@ public:
         auto* context = static_cast<Backend::WindowContext*>(sender.GetUserData());
         LLGL_VERIFY(context != nullptr);
         context->mousePosInWindow = position;
+        ImGuiViewports::OnMouseMotion(context->imGuiContext, sender, position);
     }
 };
 
+// Returns the resolution of the scene target at the specified dynamic resolution level
+static LLGL::Extent2D GetSceneResolution(const LLGL::Extent2D& resolution, std::uint32_t level)
+{
+    const float scale = DynamicResolution::GetLevelScale(level);
+    return LLGL::Extent2D
+    {
+        std::max(1u, static_cast<std::uint32_t>(static_cast<float>(resolution.width) * scale + 0.5f)),
+        std::max(1u, static_cast<std::uint32_t>(static_cast<float>(resolution.height) * scale + 0.5f))
+    };
+}
+
+// Returns the description of the scene target at the specified dynamic resolution level.
+// Scene targets use the swap-chain formats, so the scene PSO is compatible with both.
+static RenderGraph::TargetDesc GetSceneTargetDesc(const LLGL::SwapChain& swapChain, std::uint32_t level)
+{
+    RenderGraph::TargetDesc desc;
+    {
+        desc.debugName          = "Scene.ColorTarget";
+        desc.resolution         = GetSceneResolution(swapChain.GetResolution(), level);
+        desc.colorFormat        = swapChain.GetColorFormat();
+        desc.depthStencilFormat = swapChain.GetDepthStencilFormat();
+    }
+    return desc;
+}
+
 void Backend::OnResizeSurface(WindowContext& context, const LLGL::Extent2D& size)
 {
+    // The frame in flight may still render into the swap chain and scene targets
+    renderThread.WaitIdle();
+
     context.swapChain->ResizeBuffers(size);
+    MemoryTracker::Get().TrackResource(context.swapChain, MemoryCategory::SwapChain, SwapChainPool::GetMemorySize(*context.swapChain), "SwapChain", context.windowIndex);
+
+    // Scene targets of the old size are never used again
+    if (context.renderGraph)
+    {
+        context.renderGraph->ReleaseTargets();
+        ReserveSceneTargets(context);
+    }
+
     const float aspectRatio = static_cast<float>(size.width) / static_cast<float>(size.height);
     ViewProjection(context.view, aspectRatio);
 }
 
+void Backend::ReserveSceneTargets(WindowContext& context)
+{
+    RenderGraph& graph = *context.renderGraph;
+    graph.ReserveSwapChain(*context.swapChain);
+
+    // Scene targets are reserved for all levels, so a level change never allocates textures while frames are rendered
+    const LLGL::Extent2D resolution = context.swapChain->GetResolution();
+    if (scene.upscalePSO == nullptr || resolution.width == 0 || resolution.height == 0)
+        return;
+
+    for (std::uint32_t level = 0; level < DynamicResolution::numLevels; ++level)
+        graph.ReserveTarget(GetSceneTargetDesc(*context.swapChain, level));
+}
+
 bool Backend::IsAnyWindowOpen() const
 {
     for (const WindowContext& context : windowContexts)
@@ -285,13 +383,213 @@ bool Backend::IsAnyWindowOpen() const
     return false;
 }
 
-static LLGL::ShaderSourceType GetShaderSourceType(const char* filename)
+static LLGL::ShaderSourceType GetShaderSourceType(const char* filename, bool isInMemory)
 {
     const std::size_t filenameLen = std::strlen(filename);
     if (filenameLen > 4 && std::strcmp(filename + filenameLen - 4, ".spv") == 0)
-        return LLGL::ShaderSourceType::BinaryFile;
+        return (isInMemory ? LLGL::ShaderSourceType::BinaryBuffer : LLGL::ShaderSourceType::BinaryFile);
     else
-        return LLGL::ShaderSourceType::CodeFile;
+        return (isInMemory ? LLGL::ShaderSourceType::CodeString : LLGL::ShaderSourceType::CodeFile);
+}
+
+// Creates a shader from the file in 'shaderDir', or from the shaders embedded into the executable if 'shaderDir' is empty.
+// If 'loadedSource' is specified, it holds the content of the file that has already been read into memory.
+// Returns null and appends its report to 'errors' if the shader has errors.
+static LLGL::Shader* CreateShaderFromFile(
+    const char*             debugName,
+    LLGL::ShaderType        type,
+    const std::string&      shaderDir,
+    const char*             filename,
+    const char*             entry,
+    const char*             profile,
+    std::string&            errors,
+    bool                    hasVertexInput  = false,
+    const std::string*      loadedSource    = nullptr)
+{
+    const void* sourceData = nullptr;
+    std::size_t sourceSize = 0;
+    if (loadedSource != nullptr)
+    {
+        sourceData = loadedSource->c_str();
+        sourceSize = loadedSource->size();
+    }
+    else if (shaderDir.empty())
+    {
+        const EmbeddedShader* embeddedShader = FindEmbeddedShader(filename);
+        if (embeddedShader == nullptr)
+        {
+            errors += "Shader '" + std::string(filename) + "' is not embedded into the executable\n";
+            return nullptr;
+        }
+        sourceData = embeddedShader->data;
+        sourceSize = embeddedShader->size;
+    }
+
+    const std::string path = shaderDir + filename;
+    LLGL::ShaderDescriptor shaderDesc;
+    {
+        shaderDesc.debugName    = debugName;
+        shaderDesc.type         = type;
+        shaderDesc.source       = (sourceData != nullptr ? static_cast<const char*>(sourceData) : path.c_str());
+        shaderDesc.sourceSize   = sourceSize;
+        shaderDesc.sourceType   = GetShaderSourceType(filename, sourceData != nullptr);
+        shaderDesc.entryPoint   = entry;
+        shaderDesc.profile      = profile;
+        if (hasVertexInput)
+            shaderDesc.vertex.inputAttribs = GetVertexAttribs();
+    }
+    LLGL::Shader* shader = renderer->CreateShader(shaderDesc);
+
+    if (const LLGL::Report* shaderReport = shader->GetReport())
+    {
+        if (shaderReport->HasErrors())
+        {
+            errors += "Loading shader '" + std::string(filename) + "' failed:\n" + shaderReport->GetText();
+            renderer->Release(*shader);
+            return nullptr;
+        }
+    }
+
+    return shader;
+}
+
+// Returns the filename of the upscale shader that belongs to the specified scene shader, e.g. "OpenGLUpscaleShader.vert" for "OpenGLSceneShader.vert"
+static std::string GetUpscaleShaderFilename(const char* sceneShaderFilename)
+{
+    std::string filename = sceneShaderFilename;
+    const std::size_t pos = filename.find("Scene");
+    if (pos != std::string::npos)
+        filename.replace(pos, 5, "Upscale");
+    return filename;
+}
+
+// Creates the pipeline that draws a scene target into the swap chain; dynamic resolution stays unavailable if this fails
+static void CreateUpscalePipeline(
+    const std::string&  shaderDir,
+    const char*         vertShaderFilename,
+    const char*         vertShaderEntry,
+    const char*         vertShaderProfile,
+    const char*         fragShaderFilename,
+    const char*         fragShaderEntry,
+    const char*         fragShaderProfile)
+{
+    const std::string vertFilename = GetUpscaleShaderFilename(vertShaderFilename);
+    const std::string fragFilename = GetUpscaleShaderFilename(fragShaderFilename);
+
+    std::string errors;
+    LLGL::Shader* vertShader = CreateShaderFromFile("Upscale.Vert", LLGL::ShaderType::Vertex, shaderDir, vertFilename.c_str(), vertShaderEntry, vertShaderProfile, errors);
+    LLGL::Shader* fragShader = CreateShaderFromFile("Upscale.Frag", LLGL::ShaderType::Fragment, shaderDir, fragFilename.c_str(), fragShaderEntry, fragShaderProfile, errors);
+    if (vertShader == nullptr || fragShader == nullptr)
+    {
+        LLGL::Log::Errorf(LLGL::Log::ColorFlags::StdError, "%sDynamic resolution is not available\n", errors.c_str());
+        if (vertShader != nullptr)
+            renderer->Release(*vertShader);
+        if (fragShader != nullptr)
+            renderer->Release(*fragShader);
+        return;
+    }
+
+    // The combined sampler is only used by GLSL, which has no separate texture and sampler objects
+    scene.upscaleLayout = renderer->CreatePipelineLayout(
+        LLGL::Parse("heap{texture(colorMap@0):frag, sampler(colorMapSampler@1):frag}, sampler<colorMap, colorMapSampler>(colorMap@0)")
+    );
+
+    LLGL::SamplerDescriptor samplerDesc;
+    {
+        samplerDesc.debugName       = "Upscale.Sampler";
+        samplerDesc.minFilter       = LLGL::SamplerFilter::Linear;
+        samplerDesc.magFilter       = LLGL::SamplerFilter::Linear;
+        samplerDesc.mipMapEnabled   = false;
+        samplerDesc.addressModeU    = LLGL::SamplerAddressMode::Clamp;
+        samplerDesc.addressModeV    = LLGL::SamplerAddressMode::Clamp;
+        samplerDesc.addressModeW    = LLGL::SamplerAddressMode::Clamp;
+    }
+    scene.upscaleSampler = renderer->CreateSampler(samplerDesc);
+
+    LLGL::GraphicsPipelineDescriptor psoDesc;
+    {
+        psoDesc.debugName           = "Upscale.PSO";
+        psoDesc.pipelineLayout      = scene.upscaleLayout;
+        psoDesc.vertexShader        = vertShader;
+        psoDesc.fragmentShader      = fragShader;
+        psoDesc.primitiveTopology   = LLGL::PrimitiveTopology::TriangleList;
+    }
+    scene.upscalePSO = renderer->CreatePipelineState(psoDesc);
+    MemoryTracker::Get().TrackResource(scene.upscalePSO, MemoryCategory::PipelineState, 0, psoDesc.debugName);
+
+    // Shaders are no longer needed once they are linked into the PSO
+    renderer->Release(*vertShader);
+    renderer->Release(*fragShader);
+
+    if (const LLGL::Report* upscalePSOReport = scene.upscalePSO->GetReport())
+    {
+        if (upscalePSOReport->HasErrors())
+        {
+            LLGL::Log::Errorf(LLGL::Log::ColorFlags::StdError, "%s", upscalePSOReport->GetText());
+            MemoryTracker::Get().UntrackResource(scene.upscalePSO);
+            renderer->Release(*scene.upscalePSO);
+            scene.upscalePSO = nullptr;
+        }
+    }
+}
+
+// Creates the scene PSO from its shader files; returns null and appends the reports to 'errors' on failure.
+// If 'loadedSources' is specified, it holds the vertex and fragment shader files that have already been read into memory.
+static LLGL::PipelineState* CreateScenePipeline(
+    const std::string&                  shaderDir,
+    const char*                         vertShaderFilename,
+    const char*                         vertShaderEntry,
+    const char*                         vertShaderProfile,
+    const char*                         fragShaderFilename,
+    const char*                         fragShaderEntry,
+    const char*                         fragShaderProfile,
+    std::string&                        errors,
+    const std::vector<std::string>*     loadedSources = nullptr)
+{
+    const std::string* vertSource = (loadedSources != nullptr ? &(*loadedSources)[0] : nullptr);
+    const std::string* fragSource = (loadedSources != nullptr ? &(*loadedSources)[1] : nullptr);
+
+    LLGL::Shader* vertShader = CreateShaderFromFile("Shader.Vert", LLGL::ShaderType::Vertex, shaderDir, vertShaderFilename, vertShaderEntry, vertShaderProfile, errors, true, vertSource);
+    if (vertShader == nullptr)
+        return nullptr;
+
+    LLGL::Shader* fragShader = CreateShaderFromFile("Shader.Frag", LLGL::ShaderType::Fragment, shaderDir, fragShaderFilename, fragShaderEntry, fragShaderProfile, errors, false, fragSource);
+    if (fragShader == nullptr)
+    {
+        renderer->Release(*vertShader);
+        return nullptr;
+    }
+
+    LLGL::GraphicsPipelineDescriptor psoDesc;
+    {
+        psoDesc.debugName                       = "Graphics.PSO";
+        psoDesc.pipelineLayout                  = scene.pipelineLayout;
+        psoDesc.vertexShader                    = vertShader;
+        psoDesc.fragmentShader                  = fragShader;
+        psoDesc.indexFormat                     = LLGL::Format::R32UInt;
+        psoDesc.primitiveTopology               = LLGL::PrimitiveTopology::TriangleList;
+        psoDesc.depth.testEnabled               = true;
+        psoDesc.depth.writeEnabled              = true;
+        psoDesc.rasterizer.cullMode             = LLGL::CullMode::Back;
+        psoDesc.blend.targets[0].blendEnabled   = true;
+    }
+    LLGL::PipelineState* pso = renderer->CreatePipelineState(psoDesc);
+
+    // Shaders are no longer needed once they are linked into the PSO
+    renderer->Release(*vertShader);
+    renderer->Release(*fragShader);
+
+    if (const LLGL::Report* psoReport = pso->GetReport())
+    {
+        if (psoReport->HasErrors())
+        {
+            errors += psoReport->GetText();
+            renderer->Release(*pso);
+            return nullptr;
+        }
+    }
+
+    return pso;
 }
 
 bool Backend::CreateResources(
@@ -337,10 +635,22 @@ bool Backend::CreateResources(
         LLGL::SwapChainDescriptor swapChainDesc;
         {
             swapChainDesc.resolution    = { resX, resY };
+            swapChainDesc.swapBuffers   = options.numSwapBuffers;
             swapChainDesc.resizable     = true;
         }
         LLGL::SwapChain* swapChain = renderer->CreateSwapChain(swapChainDesc);
 
+        // LLGL only distinguishes vsync on and off, which is why there is no mailbox mode (see PresentMode).
+        // The interval itself is set by ApplyPresentPolicy() once all windows exist.
+        const bool isVsync = (options.presentMode == PresentMode::Fifo);
+
+        // Independent pacing starts at the refresh rate of the primary display
+        const std::uint32_t refreshRate = LLGL::Display::GetPrimary()->GetDisplayMode().refreshRate;
+        const float targetRate = (refreshRate > 0 ? static_cast<float>(refreshRate) : 60.0f);
+
+        const int windowIndex = static_cast<int>(this->windowContexts.size());
+        MemoryTracker::Get().TrackResource(swapChain, MemoryCategory::SwapChain, SwapChainPool::GetMemorySize(*swapChain), "SwapChain", windowIndex);
+
         // Register callback to update swap-chain on window resize
         LLGL::Window& window = LLGL::CastTo<LLGL::Window>(swapChain->GetSurface());
 
@@ -351,8 +661,14 @@ bool Backend::CreateResources(
         WindowContext context;
         {
             context.swapChain       = swapChain;
-            context.imGuiContext    = NewImGuiContext();
+            context.renderPass      = this->GetSceneRenderPass(*swapChain);
+            context.imGuiAllocator  = std::make_shared<ImGuiAllocator>(windowIndex);
+            context.renderAllocator = std::make_shared<ImGuiAllocator>(windowIndex);
+            context.imGuiContext    = NewImGuiContext(context.imGuiAllocator.get());
             context.input           = std::make_shared<LLGL::Input>(swapChain->GetSurface());
+            context.windowIndex     = windowIndex;
+            context.showcase.isVsync = isVsync;
+            context.showcase.targetRate = targetRate;
             ViewProjection(context.view, static_cast<float>(resX) / static_cast<float>(resY));
         }
         this->windowContexts.push_back(context);
@@ -370,204 +686,1184 @@ bool Backend::CreateResources(
     AddWindowWithSwapChain(static_cast<int>(displaySize.width/2 - resX - windowMargin), static_cast<int>(displaySize.height/2 - resY/2), resX, resY);
     AddWindowWithSwapChain(static_cast<int>(displaySize.width/2 + windowMargin), static_cast<int>(displaySize.height/2 - resY/2), resX, resY);
 
+    // Decide which swap chains wait for vertical blank
+    appliedPresentPolicy = options.presentPolicy;
+    presentScheduler.Reset(windowContexts.size());
+    ApplyPresentPolicy();
+
     // Create command buffer with immediate context
     cmdBuffer = renderer->CreateCommandBuffer(LLGL::CommandBufferFlags::ImmediateSubmit);
 
     // Create scene resources
-    LLGL::BufferDescriptor viewCbufferDesc;
-    {
-        viewCbufferDesc.debugName   = "View.Cbuffer";
-        viewCbufferDesc.size        = sizeof(View);
-        viewCbufferDesc.bindFlags   = LLGL::BindFlags::ConstantBuffer;
-    }
-    scene.viewCbuffer = renderer->CreateBuffer(viewCbufferDesc);
+    CreateSceneMesh(scene.meshDesc);
+
+    // Create graphics PSO and layout; each draw selects its View and Object blocks by a descriptor set of the resource heap
+    LLGL::PipelineLayout* psoLayout = renderer->CreatePipelineLayout(
+        LLGL::Parse("heap{cbuffer(View@1):vert:frag, cbuffer(Object@2):vert}")
+    );
+    scene.pipelineLayout = psoLayout;
 
-    const LLGL::VertexAttribute vertexAttribs[3] =
+    if (!CreateSceneObjects(scene.nextNumObjects))
+        return false;
+
+    // Shaders are embedded into the executable, so it doesn't depend on the working directory. During development,
+    // '--shader-dir' loads them from files instead and reloads them on change. Builds without the embedding step
+    // fall back to the files in the source tree.
+    const std::string fileShaderDir = std::string(options.shaderDir != nullptr ? options.shaderDir : "sources/Backend") + '/' + moduleName + '/';
+    const bool useEmbeddedShaders = (options.shaderDir == nullptr && FindEmbeddedShader(vertShaderFilename) != nullptr);
+    const std::string shaderDir = (useEmbeddedShaders ? std::string{} : fileShaderDir);
+
+    std::string errors;
+    scene.graphicsPSO = CreateScenePipeline(
+        shaderDir,
+        vertShaderFilename, vertShaderEntry, vertShaderProfile,
+        fragShaderFilename, fragShaderEntry, fragShaderProfile,
+        errors
+    );
+    if (scene.graphicsPSO == nullptr)
     {
-        LLGL::VertexAttribute{ "position", LLGL::Format::RGB32Float, 0, offsetof(Vertex, position), sizeof(Vertex) },
-        LLGL::VertexAttribute{ "normal",   LLGL::Format::RGB32Float, 1, offsetof(Vertex, normal  ), sizeof(Vertex) },
-        LLGL::VertexAttribute{ "color",    LLGL::Format::RGBA8UNorm, 2, offsetof(Vertex, color   ), sizeof(Vertex) },
-    };
+        LLGL::Log::Errorf(LLGL::Log::ColorFlags::StdError, "%s", errors.c_str());
+        return false;
+    }
+    MemoryTracker::Get().TrackResource(scene.graphicsPSO, MemoryCategory::PipelineState, 0, "Graphics.PSO");
 
-    auto vertices = GenerateMeshVertices();
-    LLGL::BufferDescriptor vertexBufferDesc;
+    // Rebuild the scene PSO whenever a shader file of this backend changes. The files are read in the background,
+    // but the render system is not thread-safe, so the PSO is created between frames on the main thread.
+    if (!useEmbeddedShaders)
     {
-        vertexBufferDesc.debugName      = "Scene.Vbuffer";
-        vertexBufferDesc.size           = vertices.size() * sizeof(Vertex);
-        vertexBufferDesc.bindFlags      = LLGL::BindFlags::VertexBuffer;
-        vertexBufferDesc.vertexAttribs  = vertexAttribs;
+        shaderHotReload.Watch(
+            shaderDir,
+            { vertShaderFilename, fragShaderFilename },
+            [=](const std::vector<std::string>& sources, std::string& reloadErrors) -> LLGL::PipelineState*
+            {
+                return CreateScenePipeline(
+                    shaderDir,
+                    vertShaderFilename, vertShaderEntry, vertShaderProfile,
+                    fragShaderFilename, fragShaderEntry, fragShaderProfile,
+                    reloadErrors,
+                    &sources
+                );
+            }
+        );
     }
-    scene.vertexBuffer = renderer->CreateBuffer(vertexBufferDesc, vertices.data());
 
-    auto indices = GenerateMeshIndices();
-    LLGL::BufferDescriptor indexBufferDesc;
+    // Create upscale pipeline for dynamic resolution and the render graph of each window with the scene targets of all levels
+    CreateUpscalePipeline(shaderDir, vertShaderFilename, vertShaderEntry, vertShaderProfile, fragShaderFilename, fragShaderEntry, fragShaderProfile);
+
+    for (WindowContext& context : windowContexts)
     {
-        indexBufferDesc.debugName       = "Scene.Ibuffer";
-        indexBufferDesc.size            = indices.size() * sizeof(std::uint16_t);
-        indexBufferDesc.bindFlags       = LLGL::BindFlags::IndexBuffer;
-        indexBufferDesc.format          = LLGL::Format::R16UInt;
-        indexBufferDesc.vertexAttribs   = vertexAttribs;
+        context.renderGraph = std::make_shared<RenderGraph>(context.windowIndex, scene.upscaleLayout, scene.upscaleSampler);
+        ReserveSceneTargets(context);
     }
-    scene.indexBuffer = renderer->CreateBuffer(indexBufferDesc, indices.data());
-    scene.numIndices = static_cast<std::uint32_t>(indices.size());
 
-    // Create graphics PSO and layout
-    LLGL::PipelineLayout* psoLayout = renderer->CreatePipelineLayout(
-        LLGL::Parse("cbuffer(View@1):vert:frag")
-    );
+    return true;
+}
 
-    const std::string shaderDir = "sources/Backend/" + std::string(moduleName) + '/';
+LLGL::RenderPass* Backend::GetSceneRenderPass(const LLGL::SwapChain& swapChain)
+{
+    const LLGL::Format colorFormat = swapChain.GetColorFormat();
+    const LLGL::Format depthStencilFormat = swapChain.GetDepthStencilFormat();
 
-    const std::string vertShaderPath = shaderDir + vertShaderFilename;
-    LLGL::ShaderDescriptor vertShaderDesc;
+    for (const SceneRenderPass& entry : sceneRenderPasses)
     {
-        vertShaderDesc.debugName            = "Shader.Vert";
-        vertShaderDesc.type                 = LLGL::ShaderType::Vertex;
-        vertShaderDesc.source               = vertShaderPath.c_str();
-        vertShaderDesc.sourceType           = GetShaderSourceType(vertShaderFilename);
-        vertShaderDesc.entryPoint           = vertShaderEntry;
-        vertShaderDesc.profile              = vertShaderProfile;
-        vertShaderDesc.vertex.inputAttribs  = std::vector<LLGL::VertexAttribute>{ std::begin(vertexAttribs), std::end(vertexAttribs) };
+        if (entry.colorFormat == colorFormat && entry.depthStencilFormat == depthStencilFormat)
+            return entry.renderPass;
     }
-    LLGL::Shader* vertShader = renderer->CreateShader(vertShaderDesc);
 
-    if (const LLGL::Report* vertShaderReport = vertShader->GetReport())
+    LLGL::RenderPassDescriptor renderPassDesc;
     {
-        if (vertShaderReport->HasErrors())
-        {
-            LLGL::Log::Errorf(LLGL::Log::ColorFlags::StdError, "Loading vertex shader failed:\n%s", vertShaderReport->GetText());
-            return false;
-        }
+        renderPassDesc.debugName                    = "Scene.RenderPass";
+        renderPassDesc.colorAttachments[0].format   = colorFormat;
+        renderPassDesc.colorAttachments[0].loadOp   = LLGL::AttachmentLoadOp::Clear;
+        renderPassDesc.colorAttachments[0].storeOp  = LLGL::AttachmentStoreOp::Store;
+        renderPassDesc.depthAttachment.format       = depthStencilFormat;
+        renderPassDesc.depthAttachment.loadOp       = LLGL::AttachmentLoadOp::Clear;
+        renderPassDesc.depthAttachment.storeOp      = LLGL::AttachmentStoreOp::Undefined;
+        renderPassDesc.stencilAttachment.format     = depthStencilFormat;
+        renderPassDesc.stencilAttachment.loadOp     = LLGL::AttachmentLoadOp::Undefined;
+        renderPassDesc.stencilAttachment.storeOp    = LLGL::AttachmentStoreOp::Undefined;
+        renderPassDesc.samples                      = swapChain.GetSamples();
+    }
+    LLGL::RenderPass* renderPass = renderer->CreateRenderPass(renderPassDesc);
+
+    SceneRenderPass entry;
+    {
+        entry.colorFormat           = colorFormat;
+        entry.depthStencilFormat    = depthStencilFormat;
+        entry.renderPass            = renderPass;
     }
+    sceneRenderPasses.push_back(entry);
+
+    return renderPass;
+}
 
-    const std::string fragShaderPath = shaderDir + fragShaderFilename;
-    LLGL::ShaderDescriptor fragShaderDesc;
+void Backend::ApplyPresentPolicy()
+{
+    if (appliedPresentPolicy != options.presentPolicy)
     {
-        fragShaderDesc.debugName    = "Shader.Frag";
-        fragShaderDesc.type         = LLGL::ShaderType::Fragment;
-        fragShaderDesc.source       = fragShaderPath.c_str();
-        fragShaderDesc.sourceType   = GetShaderSourceType(fragShaderFilename);
-        fragShaderDesc.entryPoint   = fragShaderEntry;
-        fragShaderDesc.profile      = fragShaderProfile;
+        appliedPresentPolicy = options.presentPolicy;
+        presentScheduler.Reset(windowContexts.size());
     }
-    LLGL::Shader* fragShader = renderer->CreateShader(fragShaderDesc);
 
-    if (const LLGL::Report* fragShaderReport = fragShader->GetReport())
+    // The first window that requests vsync is the primary one; with PresentPolicy::PrimaryVsync it paces all others
+    bool hasPrimary = false;
+    for (WindowContext& context : windowContexts)
     {
-        if (fragShaderReport->HasErrors())
+        const bool isPrimary = (context.showcase.isVsync && !hasPrimary);
+        hasPrimary = (hasPrimary || isPrimary);
+
+        const std::uint32_t vsyncInterval = PresentScheduler::GetVsyncInterval(options.presentPolicy, context.showcase.isVsync, isPrimary);
+        if (context.vsyncInterval != vsyncInterval)
         {
-            LLGL::Log::Errorf(LLGL::Log::ColorFlags::StdError, "Loading fragment shader failed:\n%s", fragShaderReport->GetText());
-            return false;
+            renderThread.WaitIdle();
+            context.swapChain->SetVsyncInterval(vsyncInterval);
+            context.vsyncInterval = vsyncInterval;
         }
     }
+}
 
-    LLGL::GraphicsPipelineDescriptor psoDesc;
+static void ReleaseTrackedBuffer(LLGL::Buffer*& buffer)
+{
+    if (buffer != nullptr)
     {
-        psoDesc.debugName                       = "Graphics.PSO";
-        psoDesc.pipelineLayout                  = psoLayout;
-        psoDesc.vertexShader                    = vertShader;
-        psoDesc.fragmentShader                  = fragShader;
-        psoDesc.indexFormat                     = LLGL::Format::R16UInt;
-        psoDesc.primitiveTopology               = LLGL::PrimitiveTopology::TriangleList;
-        psoDesc.depth.testEnabled               = true;
-        psoDesc.depth.writeEnabled              = true;
-        psoDesc.rasterizer.cullMode             = LLGL::CullMode::Back;
-        psoDesc.blend.targets[0].blendEnabled   = true;
+        MemoryTracker::Get().UntrackResource(buffer);
+        renderer->Release(*buffer);
+        buffer = nullptr;
     }
-    scene.graphicsPSO = renderer->CreatePipelineState(psoDesc);
+}
 
-    if (const LLGL::Report* graphicsPSOReport = scene.graphicsPSO->GetReport())
+// Generates the mesh directly into mapped buffer memory; falls back to a pre-sized CPU copy if mapping is not available
+static void GenerateMeshIntoBuffers(const MeshDescriptor& desc, const MeshSize& size, LLGL::Buffer& vertexBuffer, LLGL::Buffer& indexBuffer)
+{
+    void* mappedVertices = renderer->MapBuffer(vertexBuffer, LLGL::CPUAccess::WriteDiscard);
+    void* mappedIndices = (mappedVertices != nullptr ? renderer->MapBuffer(indexBuffer, LLGL::CPUAccess::WriteDiscard) : nullptr);
+
+    if (mappedVertices != nullptr && mappedIndices != nullptr)
     {
-        if (graphicsPSOReport->HasErrors())
-        {
-            LLGL::Log::Errorf(LLGL::Log::ColorFlags::StdError, "%s", graphicsPSOReport->GetText());
-            return false;
-        }
+        GenerateMesh(desc, static_cast<Vertex*>(mappedVertices), static_cast<std::uint32_t*>(mappedIndices));
+        renderer->UnmapBuffer(indexBuffer);
+        renderer->UnmapBuffer(vertexBuffer);
+    }
+    else
+    {
+        if (mappedVertices != nullptr)
+            renderer->UnmapBuffer(vertexBuffer);
+
+        std::unique_ptr<Vertex[]> vertices{ new Vertex[size.numVertices] };
+        std::unique_ptr<std::uint32_t[]> indices{ new std::uint32_t[size.numIndices] };
+        GenerateMesh(desc, vertices.get(), indices.get());
+        renderer->WriteBuffer(vertexBuffer, 0, vertices.get(), size.numVertices * sizeof(Vertex));
+        renderer->WriteBuffer(indexBuffer, 0, indices.get(), size.numIndices * sizeof(std::uint32_t));
     }
-
-    return true;
 }
 
-void NormalizeVector3(float* v)
+static float TicksToSeconds(std::uint64_t ticks)
 {
-    const float vecLen = std::sqrtf(v[0]*v[0] + v[1]*v[1] + v[2]*v[2]);
-    v[0] /= vecLen;
-    v[1] /= vecLen;
-    v[2] /= vecLen;
+    return static_cast<float>(static_cast<double>(ticks) / static_cast<double>(LLGL::Timer::Frequency()));
 }
 
-static void ShowImGuiElements(Backend::WindowContext& context, float dt)
+// Optimizes the mesh in place and returns the new number of vertices
+static std::uint32_t OptimizeSceneMesh(Vertex* vertices, std::uint32_t* indices, const MeshSize& size)
 {
-    // Show ImGui's demo window
-    ImGui::Begin("LLGL/ImGui Example");
-    {
-        ImGui::SeparatorText("Video");
-        {
-            ImGui::Text("Frame Rate: %.3f ms (%.1f FPS)", dt * 1000.0f, 1.0f / dt);
+    const std::uint64_t startTick = LLGL::Timer::Tick();
 
-            ImGui::Checkbox("Vsync Interval", &context.showcase.isVsync);
-        }
-        ImGui::SeparatorText("Light");
-        {
-            if (ImGui::SliderFloat3("Light Vector", context.view.lightVector, -1.0f, +1.0f))
-                NormalizeVector3(context.view.lightVector);
-        }
-        ImGui::SeparatorText("Scene");
-        {
-            ImGui::SliderFloat("Model Distance", &context.view.wMatrix[3][2], 3.0f, 25.0f);
+    MeshOptimizerStats& stats = scene.meshStats;
+    stats = MeshOptimizerStats{};
 
-            ImGui::Combo("Rotation Mode", &context.showcase.rotateMode, "Auto\0Manual\0\0");
+    stats.before = AnalyzeVertexCache(indices, size.numIndices, size.numVertices);
 
-            switch (context.showcase.rotateMode)
-            {
-            case Backend::WindowContext::RotateModeAuto:
-                if (ImGui::SliderFloat("Rotation Speed", &context.showcase.rotateSpeed, -1.0f, +1.0f))
-                {
-                    if (std::abs(context.showcase.rotateSpeed) < 0.05f)
-                        context.showcase.rotateSpeed = 0.0f;
-                }
-                break;
+    const std::vector<std::uint32_t> clusters = OptimizeVertexCache(indices, size.numIndices, size.numVertices);
+    OptimizeOverdraw(indices, size.numIndices, vertices, size.numVertices, clusters);
+    const std::uint32_t numVertices = OptimizeVertexFetch(vertices, size.numVertices, indices, size.numIndices);
 
-            case Backend::WindowContext::RotateModeManual:
-                ImGui::SliderFloat("Rotation Angle", &context.showcase.rotation, 0.0f, M_PI*2.0f);
-                break;
-            }
-        }
-        ImGui::SeparatorText("Color");
-        {
-            ImGui::ColorPicker4("Model Color", context.view.modelColor, ImGuiColorEditFlags_PickerHueWheel);
-        }
+    stats.after         = AnalyzeVertexCache(indices, size.numIndices, numVertices);
+    stats.numClusters   = static_cast<std::uint32_t>(clusters.size());
+
+    if (scene.buildMeshlets)
+    {
+        BuildMeshlets(scene.meshlets, indices, size.numIndices, vertices, numVertices);
+        stats.numMeshlets = static_cast<std::uint32_t>(scene.meshlets.meshlets.size());
     }
-    ImGui::End();
+
+    stats.optimizeTime = TicksToSeconds(LLGL::Timer::Tick() - startTick);
+
+    return numVertices;
 }
 
-static void UpdateScene(Backend::WindowContext& context, float deltaTime)
+// Appends the LODs of the mesh to the indices and optimizes each of them for the vertex cache if the mesh is optimized
+static void BuildSceneMeshLods(const Vertex* vertices, std::uint32_t numVertices, std::vector<std::uint32_t>& indices)
 {
-    switch (context.showcase.rotateMode)
+    const std::uint64_t startTick = LLGL::Timer::Tick();
+
+    scene.meshLods = BuildMeshLods(indices, vertices, numVertices);
+
+    if (scene.optimizeMesh)
     {
-    case Backend::WindowContext::RotateModeAuto:
-        context.showcase.rotation += context.showcase.rotateSpeed * deltaTime * 10.0f;
-        if (context.showcase.rotation > M_PI*2.0f)
-            context.showcase.rotation -= M_PI*2.0f;
-        if (context.showcase.rotation < 0.0f)
-            context.showcase.rotation += M_PI*2.0f;
-        break;
+        for (std::size_t i = 1; i < scene.meshLods.size(); ++i)
+            OptimizeVertexCache(indices.data() + scene.meshLods[i].firstIndex, scene.meshLods[i].numIndices, numVertices);
     }
 
-    ModelRotation(context.view, 1.0f, 1.0f, 1.0f, context.showcase.rotation);
+    scene.lodGenerationTime = TicksToSeconds(LLGL::Timer::Tick() - startTick);
 }
 
-void Backend::RenderSceneForAllContexts()
+static void UpdateSceneObjectBounds()
 {
+    scene.objects.UpdateBounds(scene.meshBounds, 0, scene.objects.GetSize());
+    scene.objectBVH.Refit(scene.objects.bounds.Data());
+}
+
+bool Backend::CreateSceneMesh(const MeshDescriptor& desc)
+{
+    const std::uint64_t startTick = LLGL::Timer::Tick();
+
+    ReleaseTrackedBuffer(scene.vertexBuffer);
+    ReleaseTrackedBuffer(scene.indexBuffer);
+
+    scene.meshStats         = MeshOptimizerStats{};
+    scene.meshlets          = MeshletBuffer{};
+    scene.lodGenerationTime = 0.0f;
+
+    MeshSize size = GetMeshSize(desc);
+
+    // The optimizer and the LOD generation need the whole mesh on the CPU, so the buffers are created with initial data in that case
+    const bool isMeshOnCPU = (scene.optimizeMesh || scene.generateLods);
+    std::unique_ptr<Vertex[]> vertices;
+    std::vector<std::uint32_t> indices;
+    if (isMeshOnCPU)
+    {
+        vertices = std::unique_ptr<Vertex[]>{ new Vertex[size.numVertices] };
+        indices.resize(size.numIndices);
+        GenerateMesh(desc, vertices.get(), indices.data());
+        if (scene.optimizeMesh)
+            size.numVertices = OptimizeSceneMesh(vertices.get(), indices.data(), size);
+    }
+
+    // All LODs share the vertex buffer and follow the full mesh in the index buffer
+    MeshLod fullMesh;
+    {
+        fullMesh.firstIndex = 0;
+        fullMesh.numIndices = size.numIndices;
+    }
+    scene.meshLods.assign(1, fullMesh);
+    if (scene.generateLods)
+        BuildSceneMeshLods(vertices.get(), size.numVertices, indices);
+
+    LLGL::BufferDescriptor vertexBufferDesc;
+    {
+        vertexBufferDesc.debugName      = "Scene.Vbuffer";
+        vertexBufferDesc.size           = size.numVertices * sizeof(Vertex);
+        vertexBufferDesc.bindFlags      = LLGL::BindFlags::VertexBuffer;
+        vertexBufferDesc.cpuAccessFlags = LLGL::CPUAccessFlags::Write;
+        vertexBufferDesc.vertexAttribs  = GetVertexAttribs();
+    }
+    scene.vertexBuffer = renderer->CreateBuffer(vertexBufferDesc, vertices.get());
+    MemoryTracker::Get().TrackResource(scene.vertexBuffer, MemoryCategory::Buffer, vertexBufferDesc.size, vertexBufferDesc.debugName);
+
+    LLGL::BufferDescriptor indexBufferDesc;
+    {
+        indexBufferDesc.debugName       = "Scene.Ibuffer";
+        indexBufferDesc.size            = (isMeshOnCPU ? indices.size() : size.numIndices) * sizeof(std::uint32_t);
+        indexBufferDesc.bindFlags       = LLGL::BindFlags::IndexBuffer;
+        indexBufferDesc.cpuAccessFlags  = LLGL::CPUAccessFlags::Write;
+        indexBufferDesc.format          = LLGL::Format::R32UInt;
+    }
+    scene.indexBuffer = renderer->CreateBuffer(indexBufferDesc, (isMeshOnCPU ? indices.data() : nullptr));
+    MemoryTracker::Get().TrackResource(scene.indexBuffer, MemoryCategory::Buffer, indexBufferDesc.size, indexBufferDesc.debugName);
+
+    if (scene.vertexBuffer == nullptr || scene.indexBuffer == nullptr)
+    {
+        LLGL::Log::Errorf(LLGL::Log::ColorFlags::StdError, "Failed to create buffers for mesh with %u vertices\n", size.numVertices);
+        return false;
+    }
+
+    if (!isMeshOnCPU)
+        GenerateMeshIntoBuffers(desc, size, *scene.vertexBuffer, *scene.indexBuffer);
+
+    GetMeshBounds(desc, scene.meshBounds.min, scene.meshBounds.max);
+    UpdateSceneObjectBounds();
+
+    scene.meshDesc              = desc;
+    scene.nextMeshDesc          = desc;
+    scene.numVertices           = size.numVertices;
+    scene.numIndices            = size.numIndices;
+    scene.meshGenerationTime    = TicksToSeconds(LLGL::Timer::Tick() - startTick) - scene.meshStats.optimizeTime - scene.lodGenerationTime;
+
+    return true;
+}
+
+// Returns a pseudo-random value in [0, 1) so object layouts are reproducible
+static float RandomFloat(std::uint32_t& seed)
+{
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return static_cast<float>(seed & 0xFFFFFF) / static_cast<float>(0x1000000);
+}
+
+// Constant buffer offsets must be aligned to 256 bytes for D3D12 and this satisfies all other backends as well
+static constexpr std::uint32_t g_constantBlockStride = 256;
+
+// Upper bound of scene objects; the resource heap holds two descriptors per window and object (see CreateSceneObjects())
+static constexpr std::uint32_t g_maxSceneObjects = 65536;
+
+static_assert(sizeof(View) <= g_constantBlockStride, "View block exceeds constant buffer alignment");
+static_assert(sizeof(Object) <= g_constantBlockStride, "Object block exceeds constant buffer alignment");
+
+// Returns the CPU copy of a constant block; the View blocks of all windows come first, followed by the Object blocks
+static char* GetConstantBlock(std::uint32_t blockIndex)
+{
+    return &scene.constantBlocks[static_cast<std::size_t>(blockIndex) * g_constantBlockStride];
+}
+
+static LLGL::ResourceViewDescriptor GetConstantBlockView(std::uint32_t blockIndex, std::uint64_t blockSize)
+{
+    LLGL::BufferViewDescriptor bufferViewDesc;
+    {
+        bufferViewDesc.offset   = static_cast<std::uint64_t>(blockIndex) * g_constantBlockStride;
+        bufferViewDesc.size     = blockSize;
+    }
+    return LLGL::ResourceViewDescriptor{ scene.constantBuffer, bufferViewDesc };
+}
+
+// Fills the Object blocks in [begin, end) from the world matrices and colors of the objects
+static void FillObjectBlocks(std::uint32_t firstObjectBlock, std::uint32_t begin, std::uint32_t end)
+{
+    const ObjectStore& objects = scene.objects;
+
+    Object objectBlock;
+    for (std::uint32_t i = begin; i < end; ++i)
+    {
+        std::memcpy(objectBlock.objectMatrix, objects.worldMatrix[i], sizeof(objectBlock.objectMatrix));
+        objectBlock.objectColor[0] = objects.colorR[i];
+        objectBlock.objectColor[1] = objects.colorG[i];
+        objectBlock.objectColor[2] = objects.colorB[i];
+        objectBlock.objectColor[3] = objects.colorA[i];
+        std::memcpy(GetConstantBlock(firstObjectBlock + i), &objectBlock, sizeof(objectBlock));
+    }
+}
+
+bool Backend::CreateSceneObjects(std::uint32_t numObjects)
+{
+    constexpr float objectSpacing = 3.0f;
+
+    numObjects = std::max(1u, std::min(numObjects, g_maxSceneObjects));
+
+    // Arrange objects in a cube centered at the origin; the first object keeps the default orientation and color
+    std::uint32_t gridSize = 1;
+    while (gridSize*gridSize*gridSize < numObjects)
+        ++gridSize;
+
+    const float gridOffset = static_cast<float>(gridSize - 1) * 0.5f;
+
+    ObjectStore& objects = scene.objects;
+    objects.Clear();
+    objects.Reserve(numObjects);
+
+    std::uint32_t seed = 0x12345678;
+    for (std::uint32_t i = 0; i < numObjects; ++i)
+    {
+        const std::uint32_t index = objects.GetIndex(objects.Create());
+        objects.positionX[index] = (static_cast<float>(i % gridSize) - gridOffset) * objectSpacing;
+        objects.positionY[index] = (static_cast<float>((i / gridSize) % gridSize) - gridOffset) * objectSpacing;
+        objects.positionZ[index] = (static_cast<float>(i / (gridSize*gridSize)) - gridOffset) * objectSpacing;
+
+        if (i > 0)
+        {
+            float axis[3] =
+            {
+                RandomFloat(seed)*2.0f - 1.0f,
+                RandomFloat(seed)*2.0f - 1.0f,
+                RandomFloat(seed)*2.0f - 1.0f + 0.01f,
+            };
+            const float axisLength = std::sqrt(axis[0]*axis[0] + axis[1]*axis[1] + axis[2]*axis[2]);
+
+            objects.axisX[index]    = axis[0] / axisLength;
+            objects.axisY[index]    = axis[1] / axisLength;
+            objects.axisZ[index]    = axis[2] / axisLength;
+            objects.angle[index]    = RandomFloat(seed)*M_PI*2.0f;
+            objects.speed[index]    = RandomFloat(seed)*2.0f - 1.0f;
+            objects.colorR[index]   = 0.5f + RandomFloat(seed)*0.5f;
+            objects.colorG[index]   = 0.5f + RandomFloat(seed)*0.5f;
+            objects.colorB[index]   = 0.5f + RandomFloat(seed)*0.5f;
+        }
+    }
+
+    objects.UpdateWorldMatrices(0, numObjects);
+    objects.UpdateBounds(scene.meshBounds, 0, numObjects);
+    scene.objectBVH.Build(objects.bounds.Data(), numObjects);
+
+    // The simulation takes over the new objects with their initial angles
+    ResetSimulation();
+
+    scene.nextNumObjects = numObjects;
+
+    const std::uint32_t numWindows = static_cast<std::uint32_t>(windowContexts.size());
+
+    // Reuse constant buffer and resource heap if they are large enough. The capacity grows in powers of two, so moving the
+    // object slider rebuilds the heap at most log2(g_maxSceneObjects) times.
+    if (scene.objectCapacity < numObjects)
+    {
+        std::uint32_t objectCapacity = 1;
+        while (objectCapacity < numObjects)
+            objectCapacity *= 2;
+
+        ReleaseTrackedBuffer(scene.constantBuffer);
+        if (scene.constantHeap != nullptr)
+        {
+            renderer->Release(*scene.constantHeap);
+            scene.constantHeap = nullptr;
+        }
+
+        const std::uint32_t numBlocks = numWindows + objectCapacity;
+
+        LLGL::BufferDescriptor constantBufferDesc;
+        {
+            constantBufferDesc.debugName    = "Scene.Cbuffer";
+            constantBufferDesc.size         = static_cast<std::uint64_t>(numBlocks) * g_constantBlockStride;
+            constantBufferDesc.bindFlags    = LLGL::BindFlags::ConstantBuffer;
+        }
+        scene.constantBuffer = renderer->CreateBuffer(constantBufferDesc);
+        MemoryTracker::Get().TrackResource(scene.constantBuffer, MemoryCategory::Buffer, constantBufferDesc.size, constantBufferDesc.debugName);
+
+        if (scene.constantBuffer == nullptr)
+        {
+            LLGL::Log::Errorf(LLGL::Log::ColorFlags::StdError, "Failed to create constant buffer for %u objects\n", objectCapacity);
+            scene.objectCapacity = 0;
+            return false;
+        }
+
+        // Each descriptor set pairs the View block of one window with the Object block of one object,
+        // so selecting a descriptor set is the equivalent of binding the buffer with two dynamic offsets.
+        // The heap grows with windows x objects x 2 descriptors; with the two windows of this example and
+        // g_maxSceneObjects, that is at most 262144 descriptors, within the 1000000 of a D3D12 shader-visible heap.
+        std::vector<LLGL::ResourceViewDescriptor> resourceViews;
+        resourceViews.reserve(static_cast<std::size_t>(numWindows) * objectCapacity * 2);
+
+        for (std::uint32_t windowIndex = 0; windowIndex < numWindows; ++windowIndex)
+        {
+            for (std::uint32_t objectIndex = 0; objectIndex < objectCapacity; ++objectIndex)
+            {
+                resourceViews.push_back(GetConstantBlockView(windowIndex, sizeof(View)));
+                resourceViews.push_back(GetConstantBlockView(numWindows + objectIndex, sizeof(Object)));
+            }
+        }
+
+        LLGL::ResourceHeapDescriptor constantHeapDesc;
+        {
+            constantHeapDesc.debugName          = "Scene.Heap";
+            constantHeapDesc.pipelineLayout     = scene.pipelineLayout;
+            constantHeapDesc.numResourceViews   = static_cast<std::uint32_t>(resourceViews.size());
+        }
+        scene.constantHeap = renderer->CreateResourceHeap(constantHeapDesc, resourceViews);
+
+        scene.constantBlocks.resize(static_cast<std::size_t>(numBlocks) * g_constantBlockStride);
+        scene.objectCapacity = objectCapacity;
+    }
+
+    FillObjectBlocks(numWindows, 0, numObjects);
+    scene.areObjectBlocksDirty = true;
+
+    return true;
+}
+
+// Advances the rotation of the objects in [begin, end) unless it is taken from the fixed-timestep simulation,
+// and updates their world matrices and bounds
+static void AnimateSceneObjects(bool useFixedTimestep, float deltaTime, std::uint32_t begin, std::uint32_t end)
+{
+    if (!useFixedTimestep)
+        scene.objects.Animate(deltaTime, begin, end);
+    scene.objects.UpdateWorldMatrices(begin, end);
+    scene.objects.UpdateBounds(scene.meshBounds, begin, end);
+}
+
+static void RefitSceneObjects()
+{
+    const std::uint64_t startTick = LLGL::Timer::Tick();
+    scene.objectBVH.Refit(scene.objects.bounds.Data());
+    scene.refitTime = TicksToSeconds(LLGL::Timer::Tick() - startTick);
+}
+
+// Selects the LOD of each visible object from the projected size of its error in the window
+static void SelectSceneObjectLods(Backend::WindowContext& context)
+{
+    context.visibleLods.resize(context.visibleObjects.size());
+    context.objectLods.resize(scene.objects.GetSize(), 0);
+    context.numLodTriangles = 0;
+
+    // One object space unit at distance d covers (height/2 * cot(fov/2)) / d pixels; objects are not scaled
+    const float resolutionY = static_cast<float>(context.swapChain->GetResolution().height);
+    const float pixelsPerUnitAtOne = 0.5f * resolutionY * context.view.vpMatrix[1][1];
+    const float (&m)[4][4] = context.view.wMatrix;
+
+    for (std::size_t i = 0; i < context.visibleObjects.size(); ++i)
+    {
+        const std::uint32_t objectIndex = context.visibleObjects[i];
+        const AABB& bounds = scene.objects.bounds[objectIndex];
+
+        // View depth of the nearest point of the bounding sphere; the model distance slider moves the whole scene in depth
+        float center[3], radius = 0.0f;
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            center[axis] = 0.5f * (bounds.min[axis] + bounds.max[axis]);
+            const float extent = 0.5f * (bounds.max[axis] - bounds.min[axis]);
+            radius += extent * extent;
+        }
+        const float depth = m[0][2]*center[0] + m[1][2]*center[1] + m[2][2]*center[2] + m[3][2] - std::sqrt(radius);
+        const float pixelsPerUnit = pixelsPerUnitAtOne / std::max(depth, 0.1f);
+
+        const std::uint32_t lod = SelectMeshLod(scene.meshLods, context.objectLods[objectIndex], pixelsPerUnit, scene.lodPixelError, scene.lodHysteresis);
+        context.objectLods[objectIndex] = static_cast<std::uint8_t>(lod);
+        context.visibleLods[i]          = static_cast<std::uint8_t>(lod);
+        context.numLodTriangles        += scene.meshLods[lod].numIndices / 3;
+    }
+}
+
+// Culls the objects against the window's view frustum
+static void CullSceneObjects(Backend::WindowContext& context)
+{
+    const std::uint64_t startTick = LLGL::Timer::Tick();
+
+    // The window's world matrix transforms the whole scene, so the frustum is extracted from both matrices
+    float vpwMatrix[4][4];
+    MultiplyMatrices(vpwMatrix, context.view.vpMatrix, context.view.wMatrix);
+
+    const bool isUnitCube = (renderer->GetRenderingCaps().clippingRange == LLGL::ClippingRange::MinusOneToOne);
+    const Frustum frustum = ExtractFrustum(vpwMatrix, isUnitCube);
+
+    context.visibleObjects.clear();
+    scene.objectBVH.Cull(frustum, context.visibleObjects);
+
+    // Draw objects in creation order to keep the output stable across frames
+    std::sort(context.visibleObjects.begin(), context.visibleObjects.end());
+
+    SelectSceneObjectLods(context);
+
+    context.cullingTime = TicksToSeconds(LLGL::Timer::Tick() - startTick);
+}
+
+void NormalizeVector3(float* v)
+{
+    const float vecLen = std::sqrtf(v[0]*v[0] + v[1]*v[1] + v[2]*v[2]);
+    v[0] /= vecLen;
+    v[1] /= vecLen;
+    v[2] /= vecLen;
+}
+
+static void FormatMemorySize(char* buffer, std::size_t bufferSize, std::uint64_t size)
+{
+    if (size >= 1024ull*1024ull)
+        std::snprintf(buffer, bufferSize, "%.2f MiB", static_cast<double>(size) / (1024.0*1024.0));
+    else if (size >= 1024ull)
+        std::snprintf(buffer, bufferSize, "%.1f KiB", static_cast<double>(size) / 1024.0);
+    else
+        std::snprintf(buffer, bufferSize, "%u B", static_cast<unsigned>(size));
+}
+
+static void ShowMemoryStatistics(const Backend::WindowContext& context)
+{
+    const MemoryTracker& memoryTracker = MemoryTracker::Get();
+
+    char liveText[32], peakText[32], windowText[32];
+
+    if (ImGui::BeginTable("MemoryStats", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit))
+    {
+        ImGui::TableSetupColumn("Category");
+        ImGui::TableSetupColumn("Count");
+        ImGui::TableSetupColumn("Live");
+        ImGui::TableSetupColumn("Peak");
+        ImGui::TableSetupColumn("Window");
+        ImGui::TableHeadersRow();
+
+        for (int i = 0; i < static_cast<int>(MemoryCategory::Count); ++i)
+        {
+            const MemoryCategory category = static_cast<MemoryCategory>(i);
+            const MemoryStats stats = memoryTracker.GetStats(category);
+            const MemoryStats windowStats = memoryTracker.GetWindowStats(context.windowIndex, category);
+
+            FormatMemorySize(liveText, sizeof(liveText), stats.liveBytes);
+            FormatMemorySize(peakText, sizeof(peakText), stats.peakBytes);
+            FormatMemorySize(windowText, sizeof(windowText), windowStats.liveBytes);
+
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn(); ImGui::TextUnformatted(ToString(category));
+            ImGui::TableNextColumn(); ImGui::Text("%llu", static_cast<unsigned long long>(stats.liveCount));
+            ImGui::TableNextColumn(); ImGui::TextUnformatted(liveText);
+            ImGui::TableNextColumn(); ImGui::TextUnformatted(peakText);
+            ImGui::TableNextColumn(); ImGui::TextUnformatted(windowText);
+        }
+
+        ImGui::EndTable();
+    }
+
+    FormatMemorySize(liveText, sizeof(liveText), memoryTracker.GetTotalLiveBytes());
+    FormatMemorySize(peakText, sizeof(peakText), memoryTracker.GetTotalPeakBytes());
+    ImGui::Text("Total: %s (peak %s)", liveText, peakText);
+
+    if (context.imGuiAllocator)
+    {
+        const ImGuiAllocator::Statistics& allocStats = context.imGuiAllocator->GetStatistics();
+        FormatMemorySize(liveText, sizeof(liveText), allocStats.reservedBytes);
+        ImGui::Text(
+            "ImGui Allocator: %u allocs/frame, %u frees/frame, %s reserved",
+            static_cast<unsigned>(allocStats.frameAllocs), static_cast<unsigned>(allocStats.frameFrees), liveText
+        );
+        ImGui::Text(
+            "Pool: %llu, Large: %llu",
+            static_cast<unsigned long long>(allocStats.numPoolAllocs),
+            static_cast<unsigned long long>(allocStats.numLargeAllocs)
+        );
+    }
+
+    ImGui::PlotLines(
+        "Total (MiB)",
+        memoryTracker.GetHistory(),
+        MemoryTracker::historySize,
+        memoryTracker.GetHistoryOffset(),
+        nullptr,
+        0.0f,
+        FLT_MAX,
+        ImVec2{ 0.0f, 40.0f }
+    );
+}
+
+static void ShowLogStatistics()
+{
+    if (!options.asyncLog)
+    {
+        ImGui::TextDisabled("Log is written synchronously; run without --sync-log for the asynchronous sink");
+        return;
+    }
+
+    const LogSink::Stats stats = LogSink::Get().GetStats();
+    ImGui::Text(
+        "Written: %llu, Suppressed: %llu",
+        static_cast<unsigned long long>(stats.numWritten), static_cast<unsigned long long>(stats.numSuppressed)
+    );
+
+    // Dropped messages mean the ring was too small for a burst, so they are highlighted like errors
+    if (stats.numDropped > 0)
+        ImGui::TextColored(ImVec4{ 1.0f, 0.4f, 0.4f, 1.0f }, "Dropped: %llu", static_cast<unsigned long long>(stats.numDropped));
+    else
+        ImGui::Text("Dropped: 0");
+}
+
+static void ShowShaderHotReload(const ShaderHotReload& shaderHotReload)
+{
+    if (!shaderHotReload.IsWatching())
+    {
+        ImGui::TextDisabled("Shader directory is not watched; run with --shader-dir=sources/Backend");
+        return;
+    }
+
+    if (shaderHotReload.IsCompiling())
+        ImGui::Text("Loading ...");
+    else
+    {
+        ImGui::Text(
+            "%u reloads, last load %.2f ms, compile %.2f ms (main thread stall)",
+            shaderHotReload.GetNumReloads(), shaderHotReload.GetLoadTime() * 1000.0f, shaderHotReload.GetCompileTime() * 1000.0f
+        );
+    }
+
+    // Keep showing the report of a failed reload until the next reload succeeds
+    const std::string& errors = shaderHotReload.GetErrors();
+    if (!errors.empty())
+        ImGui::TextColored(ImVec4{ 1.0f, 0.4f, 0.4f, 1.0f }, "%s", errors.c_str());
+}
+
+static void ShowImGuiElements(
+    Backend::WindowContext& context,
+    const ShaderHotReload&  shaderHotReload,
+    const RenderThread&     renderThread,
+    bool                    isRenderThreadSupported,
+    float                   dt)
+{
+    // Show ImGui's demo window
+    ImGui::Begin("LLGL/ImGui Example");
+    {
+        ImGui::SeparatorText("Video");
+        context.drawStats.BeginWidget("Video");
+        {
+            ImGui::Text("Frame Rate: %.3f ms (%.1f FPS)", dt * 1000.0f, 1.0f / dt);
+
+            ImGui::Checkbox("Vsync Interval", &context.showcase.isVsync);
+
+            // The present policy is shared by all windows, so multiple vsynced windows don't divide the display rate
+            int presentPolicy = static_cast<int>(options.presentPolicy);
+            if (ImGui::Combo("Present Policy", &presentPolicy, "Sequential\0Primary Vsync\0Independent\0\0"))
+                options.presentPolicy = static_cast<PresentPolicy>(presentPolicy);
+
+            if (options.presentPolicy == PresentPolicy::Independent)
+                ImGui::SliderFloat("Target Rate", &context.showcase.targetRate, 10.0f, 240.0f, "%.0f Hz");
+
+            // Record and present on a separate thread, so building the GUI overlaps with submitting the previous frame
+            ImGui::BeginDisabled(!isRenderThreadSupported);
+            {
+                ImGui::Checkbox("Render Thread", &options.renderThread);
+            }
+            ImGui::EndDisabled();
+
+            if (renderThread.IsRunning())
+                ImGui::Text("Waited %.2f ms for previous frame", renderThread.GetWaitTime() * 1000.0f);
+
+            // Swap chains of ImGui windows outside the main window are recycled, so dragging windows around does not create new ones
+            if (ImGuiViewports::IsEnabled())
+            {
+                const SwapChainPool::Stats poolStats = ImGuiViewports::Get().GetPoolStats();
+                ImGui::Text("Viewports: %u active, %u pooled", poolStats.numAcquired, poolStats.numPooled);
+                ImGui::Text("Swap Chains: %llu created, %llu reused, %llu resized", static_cast<unsigned long long>(poolStats.numCreated), static_cast<unsigned long long>(poolStats.numReused), static_cast<unsigned long long>(poolStats.numResized));
+            }
+
+            ImGui::Checkbox("Draw Statistics", &context.showcase.showDrawStats);
+            ImGui::Checkbox("Command Statistics", &context.showcase.showCommandStats);
+            ImGui::Checkbox("Stress Test", &context.showcase.showStressPanel);
+
+            // Scale the scene resolution to keep the frame time within budget; the GUI is always rendered natively
+            ImGui::BeginDisabled(scene.upscalePSO == nullptr);
+            {
+                if (ImGui::Checkbox("Dynamic Resolution", &scene.useDynamicResolution))
+                    scene.dynamicResolution.Reset();
+            }
+            ImGui::EndDisabled();
+
+            if (scene.useDynamicResolution && scene.upscalePSO != nullptr)
+            {
+                float frameBudget = scene.dynamicResolution.targetFrameTime * 1000.0f;
+                if (ImGui::SliderFloat("Frame Budget", &frameBudget, 4.0f, 50.0f, "%.1f ms"))
+                    scene.dynamicResolution.targetFrameTime = frameBudget / 1000.0f;
+
+                const LLGL::Extent2D resolution = GetSceneResolution(context.swapChain->GetResolution(), scene.dynamicResolution.GetLevel());
+                ImGui::Text(
+                    "Scale %.1f%% (%u x %u), average %.2f ms",
+                    scene.dynamicResolution.GetScale() * 100.0f, resolution.width, resolution.height,
+                    scene.dynamicResolution.GetSmoothedFrameTime() * 1000.0f
+                );
+            }
+        }
+        context.drawStats.EndWidget();
+        ImGui::SeparatorText("Light");
+        context.drawStats.BeginWidget("Light");
+        {
+            if (ImGui::SliderFloat3("Light Vector", context.view.lightVector, -1.0f, +1.0f))
+                NormalizeVector3(context.view.lightVector);
+        }
+        context.drawStats.EndWidget();
+        ImGui::SeparatorText("Scene");
+        context.drawStats.BeginWidget("Scene");
+        {
+            ImGui::SliderFloat("Model Distance", &context.view.wMatrix[3][2], 3.0f, 25.0f);
+
+            // Regenerate mesh between frames and only once the tessellation slider has been released
+            int meshType = static_cast<int>(scene.nextMeshDesc.type);
+            if (ImGui::Combo("Mesh", &meshType, "Cube\0Sphere\0Torus\0Plane\0\0"))
+            {
+                scene.nextMeshDesc.type = static_cast<MeshType>(meshType);
+                scene.isMeshDirty = true;
+            }
+
+            int tessellation = static_cast<int>(scene.nextMeshDesc.tessellation);
+            if (ImGui::SliderInt("Tessellation", &tessellation, 1, 1024, "%d", ImGuiSliderFlags_Logarithmic))
+                scene.nextMeshDesc.tessellation = static_cast<std::uint32_t>(tessellation);
+            if (ImGui::IsItemDeactivatedAfterEdit())
+                scene.isMeshDirty = true;
+
+            ImGui::Text(
+                "%u vertices, %u triangles (%.2f ms)",
+                scene.numVertices, scene.numIndices / 3, scene.meshGenerationTime * 1000.0f
+            );
+
+            if (ImGui::Checkbox("Optimize Mesh", &scene.optimizeMesh))
+                scene.isMeshDirty = true;
+            if (scene.optimizeMesh)
+            {
+                if (ImGui::Checkbox("Build Meshlets", &scene.buildMeshlets))
+                    scene.isMeshDirty = true;
+
+                const MeshOptimizerStats& stats = scene.meshStats;
+                ImGui::Text("ACMR %.3f -> %.3f, ATVR %.3f -> %.3f", stats.before.acmr, stats.after.acmr, stats.before.atvr, stats.after.atvr);
+                ImGui::Text("%u clusters, %u meshlets (%.2f ms)", stats.numClusters, stats.numMeshlets, stats.optimizeTime * 1000.0f);
+            }
+
+            // Objects draw coarser LODs the smaller their simplification error appears on screen
+            if (ImGui::Checkbox("Generate LODs", &scene.generateLods))
+                scene.isMeshDirty = true;
+            if (scene.generateLods)
+            {
+                ImGui::SliderFloat("LOD Pixel Error", &scene.lodPixelError, 0.25f, 16.0f, "%.2f px", ImGuiSliderFlags_Logarithmic);
+                ImGui::SliderFloat("LOD Hysteresis", &scene.lodHysteresis, 0.0f, 0.5f);
+                ImGui::Text(
+                    "%u LODs, %u of %u triangles drawn (%.2f ms)",
+                    static_cast<std::uint32_t>(scene.meshLods.size()),
+                    context.numLodTriangles,
+                    static_cast<std::uint32_t>(context.visibleObjects.size()) * (scene.numIndices / 3),
+                    scene.lodGenerationTime * 1000.0f
+                );
+            }
+
+            int numObjects = static_cast<int>(scene.nextNumObjects);
+            if (ImGui::SliderInt("Objects", &numObjects, 1, static_cast<int>(g_maxSceneObjects), "%d", ImGuiSliderFlags_Logarithmic))
+                scene.nextNumObjects = static_cast<std::uint32_t>(numObjects);
+            if (ImGui::IsItemDeactivatedAfterEdit())
+                scene.areObjectsDirty = true;
+
+            ImGui::Checkbox("Animate Objects", &scene.animateObjects);
+
+            // Simulate rotations in fixed steps and interpolate between the last two, so animation doesn't depend on the frame rate
+            ImGui::Checkbox("Fixed Timestep", &scene.useFixedTimestep);
+            if (scene.useFixedTimestep)
+            {
+                ImGui::SliderFloat("Simulation Rate", &options.simulationRate, 10.0f, 240.0f, "%.0f Hz");
+                ImGui::Checkbox("Simulation Thread", &options.simulationThread);
+            }
+            ImGui::Text(
+                "%u of %u objects visible, %u BVH nodes",
+                static_cast<std::uint32_t>(context.visibleObjects.size()),
+                scene.objects.GetSize(),
+                scene.objectBVH.GetNumNodes()
+            );
+            ImGui::Text("Culling %.2f ms, refit %.2f ms", context.cullingTime * 1000.0f, scene.refitTime * 1000.0f);
+            ImGui::Text("Update %.2f ms on %u worker threads", scene.updateTime * 1000.0f, JobSystem::Get().GetNumWorkers() + 1);
+
+            ImGui::Combo("Rotation Mode", &context.showcase.rotateMode, "Auto\0Manual\0\0");
+
+            switch (context.showcase.rotateMode)
+            {
+            case Backend::WindowContext::RotateModeAuto:
+                if (ImGui::SliderFloat("Rotation Speed", &context.showcase.rotateSpeed, -1.0f, +1.0f))
+                {
+                    if (std::abs(context.showcase.rotateSpeed) < 0.05f)
+                        context.showcase.rotateSpeed = 0.0f;
+                }
+                break;
+
+            case Backend::WindowContext::RotateModeManual:
+                ImGui::SliderFloat("Rotation Angle", &context.showcase.rotation, 0.0f, M_PI*2.0f);
+                break;
+            }
+        }
+        context.drawStats.EndWidget();
+        ImGui::SeparatorText("Color");
+        context.drawStats.BeginWidget("Color");
+        {
+            ImGui::ColorPicker4("Model Color", context.view.modelColor, ImGuiColorEditFlags_PickerHueWheel);
+        }
+        context.drawStats.EndWidget();
+        ImGui::SeparatorText("Shaders");
+        context.drawStats.BeginWidget("Shaders");
+        {
+            ShowShaderHotReload(shaderHotReload);
+        }
+        context.drawStats.EndWidget();
+        ImGui::SeparatorText("Memory");
+        context.drawStats.BeginWidget("Memory");
+        {
+            ShowMemoryStatistics(context);
+        }
+        context.drawStats.EndWidget();
+        ImGui::SeparatorText("Log");
+        context.drawStats.BeginWidget("Log");
+        {
+            ShowLogStatistics();
+        }
+        context.drawStats.EndWidget();
+    }
+    ImGui::End();
+
+    if (context.showcase.showDrawStats)
+        context.drawStats.ShowPanel(&context.showcase.showDrawStats);
+
+    if (context.showcase.showCommandStats)
+        context.commandStats.ShowPanel(&context.showcase.showCommandStats, &options.debuggerCommandStats, IsDebuggerAttached());
+
+    if (context.showcase.showStressPanel)
+        StressPanel::Get().ShowPanel(&context.showcase.showStressPanel);
+}
+
+static void UpdateScene(Backend::WindowContext& context, float deltaTime)
+{
+    switch (context.showcase.rotateMode)
+    {
+    case Backend::WindowContext::RotateModeAuto:
+        context.showcase.rotation += context.showcase.rotateSpeed * deltaTime * 10.0f;
+        if (context.showcase.rotation > M_PI*2.0f)
+            context.showcase.rotation -= M_PI*2.0f;
+        if (context.showcase.rotation < 0.0f)
+            context.showcase.rotation += M_PI*2.0f;
+        break;
+    }
+
+    ModelRotation(context.view, 1.0f, 1.0f, 1.0f, context.showcase.rotation);
+}
+
+void Backend::ResetSimulation()
+{
+    std::vector<float> windowRotations;
+    windowRotations.reserve(windowContexts.size());
+    for (const WindowContext& context : windowContexts)
+        windowRotations.push_back(context.showcase.rotation);
+
+    scene.simulation.Reset(scene.objects, windowRotations);
+}
+
+void Backend::AdvanceSimulation(float deltaTime)
+{
+    Simulation& simulation = scene.simulation;
+
+    // Start from the current state whenever the fixed timestep is enabled again
+    if (!isSimulationActive)
+        ResetSimulation();
+
+    // Start or stop the simulation thread between frames
+    if (options.simulationThread && !simulation.IsThreadRunning())
+        simulation.StartThread();
+    else if (!options.simulationThread && simulation.IsThreadRunning())
+        simulation.StopThread();
+
+    simulation.SetStepRate(options.simulationRate);
+    simulation.SetAnimateObjects(scene.animateObjects);
+
+    for (const WindowContext& context : windowContexts)
+    {
+        Simulation::WindowInput input;
+        {
+            input.isAuto        = (context.showcase.rotateMode == WindowContext::RotateModeAuto);
+            input.rotateSpeed   = context.showcase.rotateSpeed;
+            input.rotation      = context.showcase.rotation;
+        }
+        simulation.SetWindowInput(static_cast<std::size_t>(context.windowIndex), input);
+    }
+
+    simulation.Advance(deltaTime);
+
+    // Manual rotations come straight from the input, so only the other windows take over the simulated rotation
+    std::vector<float> windowRotations(windowContexts.size(), 0.0f);
+    simulation.Interpolate(
+        scene.objects.angle.Data(),
+        (scene.animateObjects ? scene.objects.GetSize() : 0),
+        windowRotations.data(),
+        static_cast<std::uint32_t>(windowRotations.size())
+    );
+
+    for (WindowContext& context : windowContexts)
+    {
+        if (context.showcase.rotateMode == WindowContext::RotateModeAuto)
+            context.showcase.rotation = windowRotations[static_cast<std::size_t>(context.windowIndex)];
+    }
+}
+
+void Backend::UpdateSceneForAllContexts(float deltaTime)
+{
+    constexpr std::uint32_t objectGrainSize = 1024;
+
+    const std::uint64_t startTick = LLGL::Timer::Tick();
+
+    // Input is processed on the main thread since it accesses the ImGui contexts and LLGL input handlers
+    for (WindowContext& context : windowContexts)
+        ProcessMouseInput(context);
+
+    JobSystem& jobSystem = JobSystem::Get();
+
+    const std::uint32_t numWindows = static_cast<std::uint32_t>(windowContexts.size());
+
+    // Take the rotations from the fixed-timestep simulation, interpolated between its last two steps
+    const bool useFixedTimestep = scene.useFixedTimestep;
+    if (useFixedTimestep)
+        AdvanceSimulation(deltaTime);
+    else if (scene.simulation.IsThreadRunning())
+        scene.simulation.StopThread();
+    isSimulationActive = useFixedTimestep;
+
+    // Shared part of the job graph: object animation and Object blocks -> BVH refit
+    JobCounter objectsAnimated, objectsRefitted;
+    if (scene.animateObjects)
+    {
+        jobSystem.ParallelFor(
+            scene.objects.GetSize(),
+            objectGrainSize,
+            [useFixedTimestep, deltaTime, numWindows](std::uint32_t begin, std::uint32_t end)
+            {
+                AnimateSceneObjects(useFixedTimestep, deltaTime, begin, end);
+                FillObjectBlocks(numWindows, begin, end);
+            },
+            &objectsAnimated
+        );
+        jobSystem.RunAfter(objectsAnimated, RefitSceneObjects, &objectsRefitted);
+        scene.areObjectBlocksDirty = true;
+    }
+    else
+        scene.refitTime = 0.0f;
+
+    // Per window part of the job graph: window rotation and View block -> culling
+    JobCounter framePrepared;
+    for (WindowContext& context : windowContexts)
+    {
+        // Window rotations have already been interpolated with the fixed-timestep simulation
+        WindowContext* contextRef = &context;
+        const float windowDeltaTime = (useFixedTimestep ? 0.0f : deltaTime);
+        jobSystem.RunAfter(
+            objectsRefitted,
+            [contextRef, windowDeltaTime]()
+            {
+                UpdateScene(*contextRef, windowDeltaTime);
+                std::memcpy(GetConstantBlock(static_cast<std::uint32_t>(contextRef->windowIndex)), &contextRef->view, sizeof(View));
+                CullSceneObjects(*contextRef);
+            },
+            &framePrepared
+        );
+    }
+
+    jobSystem.Wait(framePrepared);
+
+    // The refit counter is only referenced by the per window jobs, which are all done at this point
+    jobSystem.Wait(objectsRefitted);
+
+    scene.updateTime = TicksToSeconds(LLGL::Timer::Tick() - startTick);
+}
+
+// Uploads the data to the start of the constant buffer and counts the updates
+static void UploadConstantData(const char* data, std::uint64_t dataSize, CommandStats::Counters& counters)
+{
+    constexpr std::uint64_t maxUpdateSize = 65536;
+
+    // UpdateBuffer is limited to 64 KiB per call, so the blocks are uploaded in chunks
+    cmdBuffer->Begin();
+    {
+        for (std::uint64_t offset = 0; offset < dataSize; offset += maxUpdateSize)
+        {
+            const std::uint64_t chunkSize = std::min(maxUpdateSize, dataSize - offset);
+            cmdBuffer->UpdateBuffer(*scene.constantBuffer, offset, data + offset, chunkSize);
+            ++counters.bufferUpdates;
+            counters.bufferUpdateBytes += chunkSize;
+        }
+    }
+    cmdBuffer->End();
+}
+
+std::uint64_t Backend::GetSceneConstantsUploadSize()
+{
+    if (scene.constantBuffer == nullptr)
+        return 0;
+
+    // View blocks are uploaded every frame, Object blocks only if they changed; both form one contiguous range
+    std::uint64_t numBlocks = windowContexts.size();
+    if (scene.areObjectBlocksDirty)
+        numBlocks += scene.objects.GetSize();
+
+    scene.areObjectBlocksDirty = false;
+
+    return numBlocks * g_constantBlockStride;
+}
+
+std::uint64_t Backend::UploadSceneConstants()
+{
+    const std::uint64_t dataSize = GetSceneConstantsUploadSize();
+    if (dataSize > 0)
+        UploadConstantData(scene.constantBlocks.data(), dataSize, pendingUploadCounters);
+    return dataSize;
+}
+
+void Backend::RenderSceneForAllContexts()
+{
+    // Start or stop the render thread between frames
+    const bool useRenderThread = (options.renderThread && IsRenderThreadSupported() && !IsImGuiViewportsEnabled());
+    if (useRenderThread && !renderThread.IsRunning())
+        renderThread.Start();
+    else if (!useRenderThread && renderThread.IsRunning())
+    {
+        renderThread.Stop();
+        for (FrameSnapshot& snapshot : frameSnapshots)
+        {
+            for (FrameSnapshot::Window& window : snapshot.windows)
+                window.isDue = false;
+        }
+    }
+
+    // Sleep until the next window is due if windows are paced independently
+    presentScheduler.WaitForNextFrame(options.presentPolicy);
+
     // Measure elapsed time between frames for smooth animations
     const std::uint64_t newTick = LLGL::Timer::Tick();
     const float deltaTime = static_cast<float>(static_cast<double>(newTick - lastTick) / static_cast<double>(LLGL::Timer::Frequency()));
 
+    UpdateSceneForAllContexts(deltaTime);
+
+    if (scene.useDynamicResolution)
+        scene.dynamicResolution.Update(deltaTime);
+
+    // Apply the data streamed by the producer of the stress test before any GUI is built
+    StressPanel::Get().Update();
+
+    // With the render thread, the main thread fills one snapshot while the render thread consumes the other one.
+    // The last frame that used this snapshot has finished, since Submit() waited for it before handing over the previous frame.
+    const bool isPipelined = renderThread.IsRunning();
+    FrameSnapshot& snapshot = frameSnapshots[numFrames % 2];
+    std::uint64_t uploadBytes = 0;
+
+    if (isPipelined)
+    {
+        uploadBytes = GetSceneConstantsUploadSize();
+        snapshot.constantData.assign(scene.constantBlocks.begin(), scene.constantBlocks.begin() + static_cast<std::ptrdiff_t>(uploadBytes));
+        snapshot.useDynamicResolution   = scene.useDynamicResolution;
+        snapshot.sceneLevel             = scene.dynamicResolution.GetLevel();
+        snapshot.useDebuggerProfile     = options.debuggerCommandStats;
+        snapshot.windows.resize(windowContexts.size());
+    }
+    else
+        uploadBytes = UploadSceneConstants();
+
+    bool hasTextureUpdates = false;
+
     for (WindowContext& context : windowContexts)
     {
-        const bool wasVsyncEnabled = context.showcase.isVsync;
+        const std::size_t windowIndex = static_cast<std::size_t>(context.windowIndex);
 
-        RenderSceneForContext(context, deltaTime);
+        // Statistics of the render thread are taken from the last frame that rendered this window with this snapshot
+        float renderThreadTime = 0.0f;
+        if (isPipelined)
+        {
+            FrameSnapshot::Window& window = snapshot.windows[windowIndex];
+            if (window.isDue)
+            {
+                context.numDrawCalls    = window.numDrawCalls;
+                context.presentTime     = window.presentTime;
+                context.commandStats.Push(window.commandCounters, window.isProfiled);
+                renderThreadTime        = window.recordTime + window.presentTime;
+                window.isDue            = false;
+            }
+        }
+
+        // Windows that are not due keep their input states until their next frame
+        if (!presentScheduler.IsDue(options.presentPolicy, windowIndex, newTick))
+            continue;
+
+        // Each window animates its UI by its own frame time, since windows may skip frames with independent pacing
+        const float windowDeltaTime = (context.lastFrameTick != 0 ? TicksToSeconds(newTick - context.lastFrameTick) : deltaTime);
+        context.lastFrameTick = newTick;
+
+        const std::uint64_t renderStartTick = LLGL::Timer::Tick();
+        if (isPipelined)
+        {
+            // Build the GUI now and hand a copy of its draw data to the render thread
+            FrameSnapshot::Window& window = snapshot.windows[windowIndex];
+            BuildGUIForContext(context, windowDeltaTime);
+            if (!window.drawData)
+                window.drawData = std::make_shared<ImGuiDrawDataCopy>();
+            window.drawData->CopyFrom(ImGui::GetDrawData());
+            window.visibleObjects   = context.visibleObjects;
+            window.visibleLods      = context.visibleLods;
+            window.isDue            = true;
+            hasTextureUpdates       = (hasTextureUpdates || window.drawData->HasTextureUpdates());
+
+            // Publish the ImGui allocation statistics of this frame
+            context.imGuiAllocator->NextFrame();
+        }
+        else
+            RenderSceneForContext(context, windowDeltaTime);
+        const float renderTime = TicksToSeconds(LLGL::Timer::Tick() - renderStartTick) + renderThreadTime;
+
+        presentScheduler.OnPresent(options.presentPolicy, windowIndex, newTick, context.showcase.targetRate);
+
+        PublishFrameMetrics(context, windowDeltaTime, renderTime, uploadBytes);
 
         // Process global input events
         if (context.input->KeyPressed(LLGL::Key::Escape))
@@ -575,69 +1871,371 @@ void Backend::RenderSceneForAllContexts()
 
         // Reset input states for current context
         context.input->Reset();
+    }
+
+    if (isPipelined)
+    {
+        FrameSnapshot* snapshotRef = &snapshot;
+        renderThread.Submit(
+            [this, snapshotRef]()
+            {
+                RenderFrameSnapshot(*snapshotRef);
+            }
+        );
 
-        // If v-sync setting changed, update swap-chain now, but never during command encoding
-        if (wasVsyncEnabled != context.showcase.isVsync)
-            context.swapChain->SetVsyncInterval(context.showcase.isVsync ? 1 : 0);
+        // Renderer backends update pending ImGui textures while rendering, so this frame cannot overlap with the next GUI
+        if (hasTextureUpdates)
+            renderThread.WaitIdle();
+    }
+
+    // If v-sync settings or the present policy changed, update swap-chains now, but never during command encoding
+    ApplyPresentPolicy();
+
+    // Resources below are replaced outside of command encoding, so the frame in flight must finish first
+    LLGL::PipelineState* reloadedPSO = shaderHotReload.Poll();
+    if (scene.isMeshDirty || scene.areObjectsDirty || reloadedPSO != nullptr)
+        renderThread.WaitIdle();
+
+    // Replace scene mesh outside of command encoding; submitted frames may still read the old buffers on the GPU
+    if (scene.isMeshDirty)
+    {
+        renderer->GetCommandQueue()->WaitIdle();
+        CreateSceneMesh(scene.nextMeshDesc);
+        scene.isMeshDirty = false;
+    }
+
+    // Replace scene objects outside of command encoding; submitted frames may still read the old constant buffer and heap on the GPU
+    if (scene.areObjectsDirty)
+    {
+        renderer->GetCommandQueue()->WaitIdle();
+        CreateSceneObjects(scene.nextNumObjects);
+        scene.areObjectsDirty = false;
+    }
+
+    // Swap in the scene PSO of a finished shader reload outside of command encoding; the GPU may still use the previous one
+    if (reloadedPSO != nullptr)
+    {
+        renderer->GetCommandQueue()->WaitIdle();
+        MemoryTracker::Get().UntrackResource(scene.graphicsPSO);
+        renderer->Release(*scene.graphicsPSO);
+        scene.graphicsPSO = reloadedPSO;
+        MemoryTracker::Get().TrackResource(scene.graphicsPSO, MemoryCategory::PipelineState, 0, "Graphics.PSO");
     }
 
     lastTick = newTick;
+    ++numFrames;
 }
 
-void Backend::RenderSceneForContext(WindowContext& context, float dt)
+void Backend::PublishFrameMetrics(const WindowContext& context, float frameTime, float renderTime, std::uint64_t uploadBytes)
 {
-    constexpr float backgroundColor[4] = { 0.2f, 0.2f, 0.4f, 1.0f };
+    MetricsExporter& metricsExporter = MetricsExporter::Get();
+    if (!metricsExporter.IsEnabled())
+        return;
+
+    const MemoryTracker& memoryTracker = MemoryTracker::Get();
+
+    std::uint64_t memoryBytes = 0;
+    for (int category = 0; category < static_cast<int>(MemoryCategory::Count); ++category)
+        memoryBytes += memoryTracker.GetWindowStats(context.windowIndex, static_cast<MemoryCategory>(category)).liveBytes;
+
+    FrameMetrics metrics;
+    {
+        metrics.frameIndex          = numFrames;
+        metrics.windowIndex         = static_cast<std::uint32_t>(context.windowIndex);
+        metrics.numDrawCalls        = context.numDrawCalls;
+        metrics.frameTime           = frameTime;
+        metrics.renderTime          = renderTime;
+        metrics.presentTime         = context.presentTime;
+        metrics.uploadBytes         = uploadBytes;
+        metrics.memoryBytes         = memoryBytes;
+        metrics.totalMemoryBytes    = memoryTracker.GetTotalLiveBytes();
+    }
+    metricsExporter.Publish(metrics);
+}
+
+// Renders the visible objects of the window, counts its commands, and returns the number of draw calls
+static std::uint32_t RenderScene(
+    LLGL::CommandBuffer&                cmdBuffer,
+    int                                 windowIndex,
+    const std::vector<std::uint32_t>&   visibleObjects,
+    const std::vector<std::uint8_t>&    visibleLods,
+    CommandStats::Counters&             counters)
+{
+    if (scene.graphicsPSO == nullptr)
+        return 0;
+
+    cmdBuffer.PushDebugGroup("RenderScene");
+    {
+        cmdBuffer.SetPipelineState(*scene.graphicsPSO);
+        cmdBuffer.SetVertexBuffer(*scene.vertexBuffer);
+        cmdBuffer.SetIndexBuffer(*scene.indexBuffer);
+
+        // Descriptor sets are laid out per window, then per object
+        const std::uint32_t firstDescriptorSet = static_cast<std::uint32_t>(windowIndex) * scene.objectCapacity;
+        for (std::size_t i = 0; i < visibleObjects.size(); ++i)
+        {
+            const MeshLod& lod = scene.meshLods[visibleLods[i]];
+            cmdBuffer.SetResourceHeap(*scene.constantHeap, firstDescriptorSet + visibleObjects[i]);
+            cmdBuffer.DrawIndexed(lod.numIndices, lod.firstIndex);
+        }
+    }
+    cmdBuffer.PopDebugGroup();
+
+    const std::uint32_t numObjects = static_cast<std::uint32_t>(visibleObjects.size());
+    counters.drawCommands       += numObjects;
+    counters.pipelineBindings   += 1;
+    counters.bufferBindings     += 2;
+    counters.resourceBindings   += numObjects;
+
+    return numObjects;
+}
+
+static std::uint32_t GetNumImGuiDrawCalls(const ImDrawData* data)
+{
+    std::uint32_t numDrawCalls = 0;
+    for (const ImDrawList* drawList : data->CmdLists)
+        numDrawCalls += static_cast<std::uint32_t>(drawList->CmdBuffer.Size);
+    return numDrawCalls;
+}
 
+void Backend::ProcessInputForContext(WindowContext& context)
+{
     ProcessMouseInput(context);
+}
+
+void Backend::BuildGUIForContext(WindowContext& context, float dt)
+{
+    BeginFrame(context);
+    {
+        ImGui::NewFrame();
+        {
+            ShowImGuiElements(context, shaderHotReload, renderThread, IsRenderThreadSupported() && !IsImGuiViewportsEnabled(), dt);
+        }
+        ImGui::Render();
+    }
+
+    // Draw lists are only complete after rendering; the statistics are shown in the next frame
+    context.drawStats.CollectDrawData(ImGui::GetDrawData());
+}
 
-    UpdateScene(context, dt);
+void Backend::RecordSceneForContext(WindowContext& context)
+{
+    constexpr float backgroundColor[4] = { 0.2f, 0.2f, 0.4f, 1.0f };
+
+    const LLGL::ClearValue clearValues[2] = { LLGL::ClearValue{ backgroundColor }, LLGL::ClearValue{} };
 
     cmdBuffer->Begin();
     {
-        // Upload new view data to GPU
-        if (scene.viewCbuffer != nullptr)
-            cmdBuffer->UpdateBuffer(*scene.viewCbuffer, 0, &context.view, sizeof(context.view));
+        cmdBuffer->BeginRenderPass(*context.swapChain, context.renderPass, 2, clearValues);
+        {
+            cmdBuffer->SetViewport(context.swapChain->GetResolution());
+            CommandStats::Counters counters;
+            RenderScene(*cmdBuffer, context.windowIndex, context.visibleObjects, context.visibleLods, counters);
+        }
+        cmdBuffer->EndRenderPass();
+    }
+    cmdBuffer->End();
+}
 
-        cmdBuffer->BeginRenderPass(*context.swapChain);
+bool Backend::FinishCommandCounters(CommandStats::Counters& counters, bool useDebugger)
+{
+    #if !NDEBUG
+    // The profile is flushed after every window, so it only contains the commands since the previous window
+    LLGL::FrameProfile profile;
+    debugger.FlushProfile(&profile);
+    if (useDebugger)
+    {
+        const std::uint64_t bufferUpdateBytes = counters.bufferUpdateBytes;
+        counters = CommandStats::FromProfile(profile);
+        counters.bufferUpdateBytes = bufferUpdateBytes;
+        return true;
+    }
+    #endif
+    return false;
+}
+
+void Backend::RenderSceneForContext(WindowContext& context, float dt)
+{
+    // Constant uploads of this frame are counted for the first window that is recorded after them
+    CommandStats::Counters counters = pendingUploadCounters;
+    pendingUploadCounters = CommandStats::Counters{};
+
+    context.numDrawCalls = RecordFrame(
+        context,
+        context.visibleObjects,
+        context.visibleLods,
+        scene.useDynamicResolution,
+        scene.dynamicResolution.GetLevel(),
+        counters,
+        [this, &context, dt]() -> std::uint32_t
         {
-            cmdBuffer->Clear(LLGL::ClearFlags::ColorDepth, LLGL::ClearValue{ backgroundColor });
+            BuildGUIForContext(context, dt);
+            EndFrame(ImGui::GetDrawData());
+            const std::uint32_t numDrawCalls = GetNumImGuiDrawCalls(ImGui::GetDrawData());
 
-            cmdBuffer->SetViewport(context.swapChain->GetResolution());
+            // Publish the ImGui allocation statistics of this frame
+            context.imGuiAllocator->NextFrame();
 
-            // Render 3D scene
-            if (scene.graphicsPSO != nullptr)
-            {
-                cmdBuffer->PushDebugGroup("RenderScene");
-                {
-                    cmdBuffer->SetPipelineState(*scene.graphicsPSO);
-                    cmdBuffer->SetVertexBuffer(*scene.vertexBuffer);
-                    cmdBuffer->SetIndexBuffer(*scene.indexBuffer);
-                    cmdBuffer->SetResource(0, *scene.viewCbuffer);
-                    cmdBuffer->DrawIndexed(scene.numIndices, 0);
-                }
-                cmdBuffer->PopDebugGroup();
-            }
+            return numDrawCalls;
+        }
+    );
 
-#if WITH_IMGUI
-            // GUI Rendering with ImGui library
-            cmdBuffer->PushDebugGroup("RenderGUI");
+    const bool isProfiled = FinishCommandCounters(counters, options.debuggerCommandStats);
+    context.commandStats.Push(counters, isProfiled);
+
+    const std::uint64_t presentStartTick = LLGL::Timer::Tick();
+    context.swapChain->Present();
+    context.presentTime = TicksToSeconds(LLGL::Timer::Tick() - presentStartTick);
+
+    // Render the ImGui windows that were dragged out of this window into their own swap chains
+    ImGuiViewports::Get().UpdatePlatformWindows();
+}
+
+void Backend::RecordViewport(LLGL::SwapChain& swapChain, ImDrawData* drawData)
+{
+    // Secondary viewports only contain ImGui windows, which cover the entire swap chain
+    constexpr float backgroundColor[4] = { 0.2f, 0.2f, 0.4f, 1.0f };
+
+    const LLGL::ClearValue clearValues[2] = { LLGL::ClearValue{ backgroundColor }, LLGL::ClearValue{} };
+
+    cmdBuffer->Begin();
+    {
+        cmdBuffer->BeginRenderPass(swapChain, GetSceneRenderPass(swapChain), 2, clearValues);
+        {
+            cmdBuffer->SetViewport(swapChain.GetResolution());
+            cmdBuffer->PushDebugGroup("RenderViewport");
             {
-                g_backend->BeginFrame(context);
-                {
-                    ImGui::NewFrame();
-                    {
-                        ShowImGuiElements(context, dt);
-                    }
-                    ImGui::Render();
-                }
-                g_backend->EndFrame(ImGui::GetDrawData());
+                EndFrame(drawData);
             }
             cmdBuffer->PopDebugGroup();
-#endif
         }
         cmdBuffer->EndRenderPass();
     }
     cmdBuffer->End();
+}
 
-    context.swapChain->Present();
+void Backend::RenderFrameSnapshot(FrameSnapshot& snapshot)
+{
+    // Constant uploads are counted for the first window that is recorded after them
+    CommandStats::Counters uploadCounters;
+    if (!snapshot.constantData.empty())
+        UploadConstantData(snapshot.constantData.data(), snapshot.constantData.size(), uploadCounters);
+
+    for (std::size_t windowIndex = 0; windowIndex < snapshot.windows.size(); ++windowIndex)
+    {
+        FrameSnapshot::Window& window = snapshot.windows[windowIndex];
+        if (!window.isDue)
+            continue;
+
+        WindowContext& context = windowContexts[windowIndex];
+
+        const std::uint64_t recordStartTick = LLGL::Timer::Tick();
+        window.commandCounters = uploadCounters;
+        uploadCounters = CommandStats::Counters{};
+        window.numDrawCalls = RecordFrame(
+            context,
+            window.visibleObjects,
+            window.visibleLods,
+            snapshot.useDynamicResolution,
+            snapshot.sceneLevel,
+            window.commandCounters,
+            [this, &context, &window]() -> std::uint32_t
+            {
+                // Renderer backends look up their data in the current ImGui context, which is thread-local.
+                // The main thread keeps using the allocator of the context meanwhile, so allocations of the renderer backend go to a separate one.
+                ImGui::SetCurrentContext(context.imGuiContext);
+                ImGuiAllocator::SetPending(context.renderAllocator.get());
+                ImDrawData* drawData = window.drawData->GetDrawData();
+                EndFrame(drawData);
+                ImGuiAllocator::SetPending(nullptr);
+                return GetNumImGuiDrawCalls(drawData);
+            }
+        );
+        window.recordTime = TicksToSeconds(LLGL::Timer::Tick() - recordStartTick);
+        window.isProfiled = FinishCommandCounters(window.commandCounters, snapshot.useDebuggerProfile);
+
+        const std::uint64_t presentStartTick = LLGL::Timer::Tick();
+        context.swapChain->Present();
+        window.presentTime = TicksToSeconds(LLGL::Timer::Tick() - presentStartTick);
+    }
+}
+
+std::uint32_t Backend::RecordFrame(
+    WindowContext&                      context,
+    const std::vector<std::uint32_t>&   visibleObjects,
+    const std::vector<std::uint8_t>&    visibleLods,
+    bool                                useDynamicResolution,
+    std::uint32_t                       sceneLevel,
+    CommandStats::Counters&             counters,
+    const RecordGUIFunc&                recordGUI)
+{
+    constexpr float backgroundColor[4] = { 0.2f, 0.2f, 0.4f, 1.0f };
+
+    const LLGL::Extent2D resolution = context.swapChain->GetResolution();
+    const bool isSceneScaled = (useDynamicResolution && scene.upscalePSO != nullptr && resolution.width > 0 && resolution.height > 0);
+
+    std::uint32_t numDrawCalls = 0;
+
+    RenderGraph& graph = *context.renderGraph;
+    graph.Begin();
+
+    const RenderGraph::ResourceID backBuffer = graph.ImportSwapChain(*context.swapChain);
+
+    // Render 3D scene either directly into the swap chain or into the scene target of the current resolution level
+    RenderGraph::ResourceID sceneTarget = backBuffer;
+    if (isSceneScaled)
+        sceneTarget = graph.CreateTarget(GetSceneTargetDesc(*context.swapChain, sceneLevel));
+
+    const RenderGraph::PassID scenePass = graph.AddPass(
+        "Scene",
+        [&](LLGL::CommandBuffer& passCmdBuffer, const RenderGraph& /*graph*/)
+        {
+            numDrawCalls += RenderScene(passCmdBuffer, context.windowIndex, visibleObjects, visibleLods, counters);
+        }
+    );
+    graph.Write(scenePass, sceneTarget, RenderGraph::LoadAction::Clear, LLGL::ClearValue{ backgroundColor });
+
+    if (isSceneScaled)
+    {
+        // Upscale scene target with a fullscreen triangle, which covers the swap chain without clearing it first
+        const RenderGraph::PassID upscalePass = graph.AddPass(
+            "UpscaleScene",
+            [&numDrawCalls, &counters, sceneTarget](LLGL::CommandBuffer& passCmdBuffer, const RenderGraph& passGraph)
+            {
+                passCmdBuffer.SetPipelineState(*scene.upscalePSO);
+                passCmdBuffer.SetResourceHeap(*passGraph.GetSampleHeap(sceneTarget));
+                passCmdBuffer.Draw(3, 0);
+                ++numDrawCalls;
+                ++counters.drawCommands;
+                ++counters.pipelineBindings;
+                ++counters.resourceBindings;
+            }
+        );
+        graph.Read(upscalePass, sceneTarget);
+        graph.Write(upscalePass, backBuffer, RenderGraph::LoadAction::Overwrite);
+    }
+
+#if WITH_IMGUI
+    // GUI Rendering with ImGui library; continues the render pass of the swap chain
+    const RenderGraph::PassID guiPass = graph.AddPass(
+        "RenderGUI",
+        [&numDrawCalls, &counters, &recordGUI](LLGL::CommandBuffer& /*passCmdBuffer*/, const RenderGraph& /*graph*/)
+        {
+            const std::uint32_t numGUIDrawCalls = recordGUI();
+            numDrawCalls += numGUIDrawCalls;
+            counters.drawCommands += numGUIDrawCalls;
+        }
+    );
+    graph.Write(guiPass, backBuffer, RenderGraph::LoadAction::Preserve);
+#endif
+
+    cmdBuffer->Begin();
+    {
+        graph.Execute(*cmdBuffer);
+    }
+    cmdBuffer->End();
+
+    counters.renderPasses += graph.GetNumRenderPasses();
+
+    return numDrawCalls;
 }
@@ -11,6 +11,13 @@
 #include <LLGL/LLGL.h>
 #include <LLGL/Platform/Platform.h>
 #include "../Globals.h"
+#include "../ImGuiAllocator.h"
+#include "../ImGuiDrawStats.h"
+#include "../ImGuiDrawDataCopy.h"
+#include "ShaderHotReload.h"
+#include "RenderThread.h"
+#include "RenderGraph.h"
+#include "CommandStats.h"
 #include "imgui.h"
 #include <functional>
 #include <map>
@@ -30,10 +37,26 @@ public:
     struct WindowContext
     {
         LLGL::SwapChain*                swapChain       = nullptr;
+        LLGL::RenderPass*               renderPass      = nullptr;  // Shared by all swap chains with the same formats
+        std::shared_ptr<RenderGraph>    renderGraph;                // Passes of each frame; owns the offscreen scene targets
         ImGuiContext*                   imGuiContext    = nullptr;
+        std::shared_ptr<ImGuiAllocator> imGuiAllocator;             // Owned by the main thread, which builds the GUI
+        std::shared_ptr<ImGuiAllocator> renderAllocator;            // Owned by the render thread, which records the GUI
+        ImGuiDrawStats                  drawStats;
+        CommandStats                    commandStats;
         std::shared_ptr<LLGL::Input>    input;
         View                            view;
         LLGL::Offset2D                  mousePosInWindow;
+        int                             windowIndex     = 0;
+        std::vector<std::uint32_t>      visibleObjects;             // Objects that passed frustum culling in the current frame
+        std::vector<std::uint8_t>       visibleLods;                // Selected LOD of each entry in 'visibleObjects'
+        std::vector<std::uint8_t>       objectLods;                 // LOD of each object in its last visible frame; kept for hysteresis
+        std::uint32_t                   numLodTriangles = 0;        // Triangles of the visible objects at their selected LODs
+        float                           cullingTime     = 0.0f;     // CPU time in seconds to cull the objects
+        std::uint32_t                   numDrawCalls    = 0;        // Draw calls of the last frame
+        float                           presentTime     = 0.0f;     // CPU time in seconds of the last Present() call
+        std::uint32_t                   vsyncInterval   = ~0u;      // Vsync interval currently set on the swap chain; ~0 until it is set first
+        std::uint64_t                   lastFrameTick   = 0;        // Tick at the start of the last frame of this window
 
         enum RotateMode
         {
@@ -56,6 +79,10 @@ public:
             float                       rotation        = 0.0f;
             float                       rotateSpeed     = 0.1f;
             bool                        isVsync         = false;
+            float                       targetRate      = 60.0f;    // Frames per second with PresentPolicy::Independent
+            bool                        showDrawStats   = false;
+            bool                        showCommandStats = false;
+            bool                        showStressPanel = false;
         }
         showcase;
     };
@@ -76,6 +103,21 @@ public:
 
     bool IsAnyWindowOpen() const;
 
+    // Single stages of a frame, so the benchmark suite can measure them in isolation.
+    void ProcessInputForContext(WindowContext& context);
+    void BuildGUIForContext(WindowContext& context, float dt);
+    void RecordSceneForContext(WindowContext& context);
+
+    std::size_t GetNumWindows() const
+    {
+        return windowContexts.size();
+    }
+
+    WindowContext& GetWindowContext(std::size_t index)
+    {
+        return windowContexts[index];
+    }
+
     static BackendPtr NewBackend(const char* name);
 
 protected:
@@ -92,10 +134,117 @@ protected:
         const char* fragShaderProfile
     );
 
+    bool CreateSceneMesh(const MeshDescriptor& desc);
+    bool CreateSceneObjects(std::uint32_t numObjects);
+
+    // Returns true if the backend can record and present frames on the render thread. This requires that the GUI
+    // does not access the command buffer before EndFrame() and that the swap chains can be presented from any thread.
+    virtual bool IsRenderThreadSupported() const
+    {
+        return false;
+    }
+
+private:
+    // Immutable copy of everything the render thread needs to record and present one frame.
+    struct FrameSnapshot
+    {
+        struct Window
+        {
+            bool                                isDue           = false;    // Window is rendered in this frame
+            std::vector<std::uint32_t>          visibleObjects;
+            std::vector<std::uint8_t>           visibleLods;
+            std::shared_ptr<ImGuiDrawDataCopy>  drawData;
+            std::uint32_t                       numDrawCalls    = 0;        // Written by the render thread
+            float                               recordTime      = 0.0f;     // Written by the render thread
+            float                               presentTime     = 0.0f;     // Written by the render thread
+            CommandStats::Counters              commandCounters;            // Written by the render thread
+            bool                                isProfiled      = false;    // Counters are from the rendering debugger; written by the render thread
+        };
+
+        std::vector<char>       constantData;                   // Constant blocks to upload at the start of the frame
+        bool                    useDynamicResolution = false;
+        std::uint32_t           sceneLevel          = 0;
+        bool                    useDebuggerProfile  = false;
+        std::vector<Window>     windows;                        // One entry per window context
+    };
+
+    // Records the GUI into the swap-chain render pass and returns the number of draw calls.
+    using RecordGUIFunc = std::function<std::uint32_t()>;
+
+private:
+    // Takes over the current objects and window rotations into the fixed-timestep simulation.
+    void ResetSimulation();
+
+    // Feeds the input of all windows to the fixed-timestep simulation, runs the steps that are due, and takes over the interpolated rotations.
+    void AdvanceSimulation(float deltaTime);
+
+    // Runs the per-frame scene update as job graph: shared object animation and BVH refit, then culling per window.
+    void UpdateSceneForAllContexts(float deltaTime);
+
+    // Uploads the View blocks of all windows and the changed Object blocks with a single contiguous update.
+    // Returns the number of uploaded bytes.
+    std::uint64_t UploadSceneConstants();
+
+    // Returns the number of bytes of constant blocks that must be uploaded for this frame and resets the dirty state of the Object blocks.
+    std::uint64_t GetSceneConstantsUploadSize();
+
+    // Records the scene and GUI of the window into the command buffer and returns the number of draw calls.
+    // The recorded commands are added to the lightweight 'counters'.
+    std::uint32_t RecordFrame(
+        WindowContext&                      context,
+        const std::vector<std::uint32_t>&   visibleObjects,
+        const std::vector<std::uint8_t>&    visibleLods,
+        bool                                useDynamicResolution,
+        std::uint32_t                       sceneLevel,
+        CommandStats::Counters&             counters,
+        const RecordGUIFunc&                recordGUI
+    );
+
+    // Replaces the lightweight counters of a recorded window with the profile of the rendering debugger if requested
+    // and available. Returns true if the counters were replaced.
+    bool FinishCommandCounters(CommandStats::Counters& counters, bool useDebugger);
+
+    // Records the draw data of a secondary ImGui viewport into its swap chain.
+    void RecordViewport(LLGL::SwapChain& swapChain, ImDrawData* drawData);
+
+    // Uploads the constant data of the snapshot, then records and presents each of its windows; runs on the render thread.
+    void RenderFrameSnapshot(FrameSnapshot& snapshot);
+
+    // Publishes the metrics of the last frame of the window if the metrics export is enabled.
+    void PublishFrameMetrics(const WindowContext& context, float frameTime, float renderTime, std::uint64_t uploadBytes);
+
+    // Reserves the render passes of the swap chain and the scene targets of all dynamic resolution levels in the render graph
+    // of the window. Must be called on the main thread while no frame of the window is recorded.
+    void ReserveSceneTargets(WindowContext& context);
+
+    // Returns the cached render pass for the formats of the swap chain. It clears color and depth on load
+    // and discards depth and stencil at the end, since no frame reads the previous contents.
+    LLGL::RenderPass* GetSceneRenderPass(const LLGL::SwapChain& swapChain);
+
+    // Sets the vsync interval of each swap chain for the current present policy. Only swap chains whose interval
+    // changes are updated, so this is cheap enough to call once per frame between the command encodings.
+    void ApplyPresentPolicy();
+
 private:
-    LLGL::RenderingDebugger     debugger;
-    std::uint64_t               lastTick = 0;
-    std::vector<WindowContext>  windowContexts;
+    struct SceneRenderPass
+    {
+        LLGL::Format        colorFormat;
+        LLGL::Format        depthStencilFormat;
+        LLGL::RenderPass*   renderPass;
+    };
+
+    LLGL::RenderingDebugger         debugger;
+    std::uint64_t                   lastTick = 0;
+    std::uint64_t                   numFrames = 0;
+    std::vector<WindowContext>      windowContexts;
+    std::vector<SceneRenderPass>    sceneRenderPasses;
+    ShaderHotReload                 shaderHotReload;
+    PresentScheduler                presentScheduler;
+    PresentPolicy                   appliedPresentPolicy = PresentPolicy::Sequential;
+    RenderThread                    renderThread;
+    FrameSnapshot                   frameSnapshots[2];          // Filled by the main thread and consumed by the render thread in turns
+    bool                            isSimulationActive = false; // Rotations were taken from the fixed-timestep simulation in the last frame
+    CommandStats::Counters          pendingUploadCounters;      // Constant uploads without the render thread, counted for the next window that is recorded
 };
 
 extern std::unique_ptr<Backend> g_backend;
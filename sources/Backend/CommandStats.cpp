@@ -0,0 +1,124 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * CommandStats.cpp
+ */
+
+#include "CommandStats.h"
+#include "imgui.h"
+#include <cfloat>
+
+
+CommandStats::Counters CommandStats::FromProfile(const LLGL::FrameProfile& profile)
+{
+    const LLGL::ProfileCommandBufferRecord& record = profile.commandBufferRecord;
+
+    Counters counters;
+    {
+        counters.drawCommands       = record.drawCommands;
+        counters.pipelineBindings   = record.graphicsPipelineBindings + record.computePipelineBindings;
+        counters.bufferBindings     = record.vertexBufferBindings + record.indexBufferBindings;
+        counters.resourceBindings   =
+        (
+            record.constantBufferBindings   +
+            record.sampledBufferBindings    +
+            record.storageBufferBindings    +
+            record.sampledTextureBindings   +
+            record.storageTextureBindings   +
+            record.samplerBindings          +
+            record.resourceHeapBindings
+        );
+        counters.renderPasses       = record.renderPassSections;
+        counters.bufferUpdates      = record.bufferUpdates + profile.commandQueueRecord.bufferWrites;
+    }
+    return counters;
+}
+
+void CommandStats::Push(const Counters& counters, bool isFromDebugger)
+{
+    last                = counters;
+    isLastFromDebugger  = isFromDebugger;
+
+    const int index = static_cast<int>(numFrames % historySize);
+    {
+        history[MetricDrawCommands      ][index] = static_cast<float>(counters.drawCommands);
+        history[MetricPipelineBindings  ][index] = static_cast<float>(counters.pipelineBindings);
+        history[MetricBufferBindings    ][index] = static_cast<float>(counters.bufferBindings);
+        history[MetricResourceBindings  ][index] = static_cast<float>(counters.resourceBindings);
+        history[MetricRenderPasses      ][index] = static_cast<float>(counters.renderPasses);
+        history[MetricBufferUpdates     ][index] = static_cast<float>(counters.bufferUpdates);
+        history[MetricBufferUpdateKiB   ][index] = static_cast<float>(counters.bufferUpdateBytes) / 1024.0f;
+    }
+    ++numFrames;
+}
+
+void CommandStats::ShowPanel(bool* isOpen, bool* useDebugger, bool isDebuggerAvailable)
+{
+    static const char* metricNames[NumMetrics] =
+    {
+        "Draws",
+        "Pipelines",
+        "Buffers",
+        "Resources",
+        "Render Passes",
+        "Updates",
+        "Update KiB",
+    };
+
+    ImGui::SetNextWindowSize(ImVec2{ 420.0f, 520.0f }, ImGuiCond_FirstUseEver);
+    if (ImGui::Begin("Command Statistics", isOpen))
+    {
+        // The rendering debugger is only attached in debug builds
+        ImGui::BeginDisabled(!isDebuggerAvailable);
+        {
+            ImGui::Checkbox("Rendering Debugger", useDebugger);
+        }
+        ImGui::EndDisabled();
+
+        if (isLastFromDebugger)
+            ImGui::TextDisabled("Profile of all commands, including the ImGui renderer backend");
+        else
+            ImGui::TextDisabled("Commands of the backend; ImGui only contributes its draw commands");
+
+        ImGui::Text(
+            "%u draws, %u pipelines, %u buffers, %u resources",
+            last.drawCommands, last.pipelineBindings, last.bufferBindings, last.resourceBindings
+        );
+        ImGui::Text(
+            "%u render passes, %u buffer updates (%.1f KiB)",
+            last.renderPasses, last.bufferUpdates, static_cast<float>(last.bufferUpdateBytes) / 1024.0f
+        );
+
+        // Bindings per draw close to one or above point to state changes that could be batched
+        if (last.drawCommands > 0)
+        {
+            ImGui::Text(
+                "Per draw: %.2f pipelines, %.2f resources",
+                static_cast<float>(last.pipelineBindings) / static_cast<float>(last.drawCommands),
+                static_cast<float>(last.resourceBindings) / static_cast<float>(last.drawCommands)
+            );
+        }
+
+        ImGui::SeparatorText("History");
+        {
+            const int offset = static_cast<int>(numFrames % historySize);
+            for (int metric = 0; metric < NumMetrics; ++metric)
+            {
+                ImGui::PlotLines(
+                    metricNames[metric],
+                    history[metric],
+                    historySize,
+                    offset,
+                    nullptr,
+                    0.0f,
+                    FLT_MAX,
+                    ImVec2{ 0.0f, 40.0f }
+                );
+            }
+        }
+    }
+    ImGui::End();
+}
+
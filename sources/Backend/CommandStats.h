@@ -0,0 +1,66 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * CommandStats.h
+ */
+
+#pragma once
+
+#include <LLGL/LLGL.h>
+#include <cstdint>
+
+
+// Command-stream statistics of a single window with a history of the last frames. The counters of a frame either come
+// from the profile of LLGL's rendering debugger, which sees every command including those of the ImGui renderer backends,
+// or from lightweight counters that the backend increments while recording. The latter are also available in release
+// builds, but only count the commands of the backend itself plus the draw commands of the ImGui draw data.
+class CommandStats
+{
+public:
+    struct Counters
+    {
+        std::uint32_t   drawCommands        = 0;
+        std::uint32_t   pipelineBindings    = 0;
+        std::uint32_t   bufferBindings      = 0;    // Vertex and index buffers
+        std::uint32_t   resourceBindings    = 0;    // Resource heaps and single resources
+        std::uint32_t   renderPasses        = 0;
+        std::uint32_t   bufferUpdates       = 0;
+        std::uint64_t   bufferUpdateBytes   = 0;    // Always counted by the backend, since the profile has no sizes
+    };
+
+    static constexpr int historySize = 120;
+
+public:
+    // Converts the profile of the rendering debugger into counters; 'bufferUpdateBytes' is left at zero.
+    static Counters FromProfile(const LLGL::FrameProfile& profile);
+
+    // Adds the counters of a finished frame of this window to the history.
+    void Push(const Counters& counters, bool isFromDebugger);
+
+    // Shows the counters of the last frame and their history in a separate ImGui window. The source of the counters
+    // can be switched if the rendering debugger is available.
+    void ShowPanel(bool* isOpen, bool* useDebugger, bool isDebuggerAvailable);
+
+private:
+    enum Metric
+    {
+        MetricDrawCommands = 0,
+        MetricPipelineBindings,
+        MetricBufferBindings,
+        MetricResourceBindings,
+        MetricRenderPasses,
+        MetricBufferUpdates,
+        MetricBufferUpdateKiB,
+
+        NumMetrics,
+    };
+
+private:
+    Counters        last;
+    bool            isLastFromDebugger  = false;
+    float           history[NumMetrics][historySize] = {};
+    std::uint64_t   numFrames           = 0;
+};
+
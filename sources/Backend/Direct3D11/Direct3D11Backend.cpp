@@ -86,6 +86,12 @@ public:
     {
         ImGui_ImplDX11_RenderDrawData(data);
     }
+
+    // The GUI is only recorded in EndFrame(), so frames can be recorded and presented on the render thread
+    bool IsRenderThreadSupported() const override
+    {
+        return true;
+    }
 };
 
 REGISTER_BACKEND(Direct3D11Backend, "Direct3D11");
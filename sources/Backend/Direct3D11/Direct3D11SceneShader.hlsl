@@ -14,6 +14,12 @@ cbuffer View : register(b1)
     float4   lightVector;
 }
 
+cbuffer Object : register(b2)
+{
+    float4x4 objectMatrix;
+    float4   objectColor;
+}
+
 struct VertexIn
 {
     float3 position : POSITION;
@@ -30,9 +36,9 @@ struct VertexOut
 
 void VSMain(VertexIn inp, out VertexOut outp)
 {
-    outp.position   = mul(vpMatrix, mul(wMatrix, float4(inp.position, 1)));
-    outp.normal     = normalize(mul((float3x3)wMatrix, inp.normal));
-    outp.color      = modelColor * inp.color;
+    outp.position   = mul(vpMatrix, mul(wMatrix, mul(objectMatrix, float4(inp.position, 1))));
+    outp.normal     = normalize(mul((float3x3)wMatrix, mul((float3x3)objectMatrix, inp.normal)));
+    outp.color      = modelColor * objectColor * inp.color;
 }
 
 float4 PSMain(VertexOut inp) : SV_Target
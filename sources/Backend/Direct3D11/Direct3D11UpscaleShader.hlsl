@@ -0,0 +1,30 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * Direct3D 11 Upscale Shader
+ */
+
+Texture2D    colorMap        : register(t0);
+SamplerState colorMapSampler : register(s1);
+
+struct VertexOut
+{
+    float4 position : SV_Position;
+    float2 texCoord : TEXCOORD;
+};
+
+void VSMain(uint id : SV_VertexID, out VertexOut outp)
+{
+    // Full-screen triangle from the vertex ID; texture rows start at the top
+    float2 position = float2((float)((id & 1) * 4) - 1.0, (float)((id & 2) * 2) - 1.0);
+    outp.position   = float4(position, 0, 1);
+    outp.texCoord   = float2(position.x * 0.5 + 0.5, 0.5 - position.y * 0.5);
+}
+
+float4 PSMain(VertexOut inp) : SV_Target
+{
+    return colorMap.Sample(colorMapSampler, inp.texCoord);
+}
+
@@ -208,6 +208,12 @@ public:
 
         ImGui_ImplDX12_RenderDrawData(data, d3dCommandList);
     }
+
+    // The GUI is only recorded in EndFrame(), so frames can be recorded and presented on the render thread
+    bool IsRenderThreadSupported() const override
+    {
+        return true;
+    }
 };
 
 REGISTER_BACKEND(Direct3D12Backend, "Direct3D12");
@@ -14,7 +14,14 @@ struct View
     float4   lightVector;
 };
 
-ConstantBuffer<View> view : register(b1);
+struct Object
+{
+    float4x4 objectMatrix;
+    float4   objectColor;
+};
+
+ConstantBuffer<View>   view : register(b1);
+ConstantBuffer<Object> obj  : register(b2);
 
 struct VertexIn
 {
@@ -32,9 +39,9 @@ struct VertexOut
 
 void VSMain(VertexIn inp, out VertexOut outp)
 {
-    outp.position   = mul(view.vpMatrix, mul(view.wMatrix, float4(inp.position, 1)));
-    outp.normal     = normalize(mul((float3x3)view.wMatrix, inp.normal));
-    outp.color      = view.modelColor * inp.color;
+    outp.position   = mul(view.vpMatrix, mul(view.wMatrix, mul(obj.objectMatrix, float4(inp.position, 1))));
+    outp.normal     = normalize(mul((float3x3)view.wMatrix, mul((float3x3)obj.objectMatrix, inp.normal)));
+    outp.color      = view.modelColor * obj.objectColor * inp.color;
 }
 
 float4 PSMain(VertexOut inp) : SV_Target
@@ -0,0 +1,572 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * ImGuiViewports.cpp
+ */
+
+#include "ImGuiViewports.h"
+#include "../MemoryTracker.h"
+#include <algorithm>
+#include <utility>
+
+
+ImGuiViewports& ImGuiViewports::Get()
+{
+    static ImGuiViewports instance;
+    return instance;
+}
+
+#ifdef IMGUI_HAS_VIEWPORT
+
+// Hooks of ImGuiPlatformIO that are replaced while multi-viewports are installed, named after their fields
+struct ImGuiPlatformIOHooks
+{
+    decltype(ImGuiPlatformIO::Platform_CreateWindow)        Platform_CreateWindow       = nullptr;
+    decltype(ImGuiPlatformIO::Platform_DestroyWindow)       Platform_DestroyWindow      = nullptr;
+    decltype(ImGuiPlatformIO::Platform_ShowWindow)          Platform_ShowWindow         = nullptr;
+    decltype(ImGuiPlatformIO::Platform_SetWindowPos)        Platform_SetWindowPos       = nullptr;
+    decltype(ImGuiPlatformIO::Platform_GetWindowPos)        Platform_GetWindowPos       = nullptr;
+    decltype(ImGuiPlatformIO::Platform_SetWindowSize)       Platform_SetWindowSize      = nullptr;
+    decltype(ImGuiPlatformIO::Platform_GetWindowSize)       Platform_GetWindowSize      = nullptr;
+    decltype(ImGuiPlatformIO::Platform_SetWindowFocus)      Platform_SetWindowFocus     = nullptr;
+    decltype(ImGuiPlatformIO::Platform_GetWindowFocus)      Platform_GetWindowFocus     = nullptr;
+    decltype(ImGuiPlatformIO::Platform_GetWindowMinimized)  Platform_GetWindowMinimized = nullptr;
+    decltype(ImGuiPlatformIO::Platform_SetWindowTitle)      Platform_SetWindowTitle     = nullptr;
+    decltype(ImGuiPlatformIO::Platform_SetWindowAlpha)      Platform_SetWindowAlpha     = nullptr;
+    decltype(ImGuiPlatformIO::Platform_UpdateWindow)        Platform_UpdateWindow       = nullptr;
+    decltype(ImGuiPlatformIO::Platform_RenderWindow)        Platform_RenderWindow       = nullptr;
+    decltype(ImGuiPlatformIO::Platform_SwapBuffers)         Platform_SwapBuffers        = nullptr;
+    decltype(ImGuiPlatformIO::Platform_GetWindowDpiScale)   Platform_GetWindowDpiScale  = nullptr;
+    decltype(ImGuiPlatformIO::Platform_OnChangedViewport)   Platform_OnChangedViewport  = nullptr;
+    decltype(ImGuiPlatformIO::Renderer_CreateWindow)        Renderer_CreateWindow       = nullptr;
+    decltype(ImGuiPlatformIO::Renderer_DestroyWindow)       Renderer_DestroyWindow      = nullptr;
+    decltype(ImGuiPlatformIO::Renderer_SetWindowSize)       Renderer_SetWindowSize      = nullptr;
+    decltype(ImGuiPlatformIO::Renderer_RenderWindow)        Renderer_RenderWindow       = nullptr;
+    decltype(ImGuiPlatformIO::Renderer_SwapBuffers)         Renderer_SwapBuffers        = nullptr;
+};
+
+// Platform and renderer user data of each viewport while multi-viewports are installed
+struct ImGuiViewportData
+{
+    LLGL::SwapChain*        swapChain           = nullptr;
+    LLGL::Window*           window              = nullptr;
+    ImGuiContext*           context             = nullptr;  // Context that owns the viewport; input of its window is forwarded there
+    ImGuiViewport*          viewport            = nullptr;
+    bool                    isMain              = false;    // Main viewport, whose swap chain belongs to the backend
+
+    // Only used by the main viewport to restore the state of the ImGui backends when uninstalled
+    ImGuiPlatformIOHooks    prevHooks;
+    void*                   prevUserData        = nullptr;
+    ImGuiConfigFlags        prevConfigFlags     = 0;
+    ImGuiBackendFlags       prevBackendFlags    = 0;
+};
+
+static void SwapHooks(ImGuiPlatformIO& platformIO, ImGuiPlatformIOHooks& hooks)
+{
+    #define SWAP_HOOK(NAME) std::swap(platformIO.NAME, hooks.NAME)
+
+    SWAP_HOOK(Platform_CreateWindow);
+    SWAP_HOOK(Platform_DestroyWindow);
+    SWAP_HOOK(Platform_ShowWindow);
+    SWAP_HOOK(Platform_SetWindowPos);
+    SWAP_HOOK(Platform_GetWindowPos);
+    SWAP_HOOK(Platform_SetWindowSize);
+    SWAP_HOOK(Platform_GetWindowSize);
+    SWAP_HOOK(Platform_SetWindowFocus);
+    SWAP_HOOK(Platform_GetWindowFocus);
+    SWAP_HOOK(Platform_GetWindowMinimized);
+    SWAP_HOOK(Platform_SetWindowTitle);
+    SWAP_HOOK(Platform_SetWindowAlpha);
+    SWAP_HOOK(Platform_UpdateWindow);
+    SWAP_HOOK(Platform_RenderWindow);
+    SWAP_HOOK(Platform_SwapBuffers);
+    SWAP_HOOK(Platform_GetWindowDpiScale);
+    SWAP_HOOK(Platform_OnChangedViewport);
+    SWAP_HOOK(Renderer_CreateWindow);
+    SWAP_HOOK(Renderer_DestroyWindow);
+    SWAP_HOOK(Renderer_SetWindowSize);
+    SWAP_HOOK(Renderer_RenderWindow);
+    SWAP_HOOK(Renderer_SwapBuffers);
+
+    #undef SWAP_HOOK
+}
+
+static ImGuiViewportData* GetViewportData(ImGuiViewport* viewport)
+{
+    return static_cast<ImGuiViewportData*>(viewport->PlatformUserData);
+}
+
+static LLGL::Extent2D ToExtent(const ImVec2& size)
+{
+    return LLGL::Extent2D
+    {
+        static_cast<std::uint32_t>(std::max(1.0f, size.x)),
+        static_cast<std::uint32_t>(std::max(1.0f, size.y))
+    };
+}
+
+static LLGL::Offset2D ToOffset(const ImVec2& pos)
+{
+    return LLGL::Offset2D{ static_cast<std::int32_t>(pos.x), static_cast<std::int32_t>(pos.y) };
+}
+
+// Returns the ImGui key for an LLGL key code, or ImGuiKey_None if ImGui has no equivalent
+static ImGuiKey ToImGuiKey(LLGL::Key keyCode)
+{
+    const int key = static_cast<int>(keyCode);
+    if (keyCode >= LLGL::Key::D0 && keyCode <= LLGL::Key::D9)
+        return static_cast<ImGuiKey>(ImGuiKey_0 + (key - static_cast<int>(LLGL::Key::D0)));
+    if (keyCode >= LLGL::Key::A && keyCode <= LLGL::Key::Z)
+        return static_cast<ImGuiKey>(ImGuiKey_A + (key - static_cast<int>(LLGL::Key::A)));
+    if (keyCode >= LLGL::Key::Keypad0 && keyCode <= LLGL::Key::Keypad9)
+        return static_cast<ImGuiKey>(ImGuiKey_Keypad0 + (key - static_cast<int>(LLGL::Key::Keypad0)));
+    if (keyCode >= LLGL::Key::F1 && keyCode <= LLGL::Key::F12)
+        return static_cast<ImGuiKey>(ImGuiKey_F1 + (key - static_cast<int>(LLGL::Key::F1)));
+
+    switch (keyCode)
+    {
+        case LLGL::Key::Back:           return ImGuiKey_Backspace;
+        case LLGL::Key::Tab:            return ImGuiKey_Tab;
+        case LLGL::Key::Return:         return ImGuiKey_Enter;
+        case LLGL::Key::Escape:         return ImGuiKey_Escape;
+        case LLGL::Key::Space:          return ImGuiKey_Space;
+        case LLGL::Key::PageUp:         return ImGuiKey_PageUp;
+        case LLGL::Key::PageDown:       return ImGuiKey_PageDown;
+        case LLGL::Key::End:            return ImGuiKey_End;
+        case LLGL::Key::Home:           return ImGuiKey_Home;
+        case LLGL::Key::Left:           return ImGuiKey_LeftArrow;
+        case LLGL::Key::Up:             return ImGuiKey_UpArrow;
+        case LLGL::Key::Right:          return ImGuiKey_RightArrow;
+        case LLGL::Key::Down:           return ImGuiKey_DownArrow;
+        case LLGL::Key::Insert:         return ImGuiKey_Insert;
+        case LLGL::Key::Delete:         return ImGuiKey_Delete;
+        case LLGL::Key::KeypadMultiply: return ImGuiKey_KeypadMultiply;
+        case LLGL::Key::KeypadPlus:     return ImGuiKey_KeypadAdd;
+        case LLGL::Key::KeypadMinus:    return ImGuiKey_KeypadSubtract;
+        case LLGL::Key::KeypadDecimal:  return ImGuiKey_KeypadDecimal;
+        case LLGL::Key::KeypadDivide:   return ImGuiKey_KeypadDivide;
+        case LLGL::Key::Shift:
+        case LLGL::Key::LShift:         return ImGuiKey_LeftShift;
+        case LLGL::Key::RShift:         return ImGuiKey_RightShift;
+        case LLGL::Key::Control:
+        case LLGL::Key::LControl:       return ImGuiKey_LeftCtrl;
+        case LLGL::Key::RControl:       return ImGuiKey_RightCtrl;
+        case LLGL::Key::Menu:
+        case LLGL::Key::LMenu:          return ImGuiKey_LeftAlt;
+        case LLGL::Key::RMenu:          return ImGuiKey_RightAlt;
+        case LLGL::Key::LWin:           return ImGuiKey_LeftSuper;
+        case LLGL::Key::RWin:           return ImGuiKey_RightSuper;
+        default:                        return ImGuiKey_None;
+    }
+}
+
+// Returns the ImGui modifier a key contributes to, or ImGuiKey_None if it is no modifier key
+static ImGuiKey ToImGuiModifier(ImGuiKey key)
+{
+    switch (key)
+    {
+        case ImGuiKey_LeftShift:
+        case ImGuiKey_RightShift:   return ImGuiMod_Shift;
+        case ImGuiKey_LeftCtrl:
+        case ImGuiKey_RightCtrl:    return ImGuiMod_Ctrl;
+        case ImGuiKey_LeftAlt:
+        case ImGuiKey_RightAlt:     return ImGuiMod_Alt;
+        case ImGuiKey_LeftSuper:
+        case ImGuiKey_RightSuper:   return ImGuiMod_Super;
+        default:                    return ImGuiKey_None;
+    }
+}
+
+// Returns the ImGui mouse button for an LLGL key code, or -1 if it is no mouse button
+static int ToImGuiMouseButton(LLGL::Key keyCode)
+{
+    switch (keyCode)
+    {
+        case LLGL::Key::LButton:    return ImGuiMouseButton_Left;
+        case LLGL::Key::RButton:    return ImGuiMouseButton_Right;
+        case LLGL::Key::MButton:    return ImGuiMouseButton_Middle;
+        default:                    return -1;
+    }
+}
+
+// Makes the ImGui context that owns the viewport of a window current until the end of the scope
+class ImGuiViewportContextScope
+{
+public:
+    explicit ImGuiViewportContextScope(LLGL::Window& window) :
+        data        { static_cast<ImGuiViewportData*>(window.GetUserData()) },
+        prevContext { ImGui::GetCurrentContext()                            }
+    {
+        if (data != nullptr)
+            ImGui::SetCurrentContext(data->context);
+    }
+
+    ~ImGuiViewportContextScope()
+    {
+        ImGui::SetCurrentContext(prevContext);
+    }
+
+    // Returns the IO of the context, or null if the window belongs to no viewport.
+    ImGuiIO* GetIO() const
+    {
+        return (data != nullptr ? &ImGui::GetIO() : nullptr);
+    }
+
+private:
+    ImGuiViewportData*  data        = nullptr;
+    ImGuiContext*       prevContext = nullptr;
+};
+
+// Forwards the input of the windows of secondary viewports to the ImGui context that owns the viewport:
+// mouse buttons, wheel, keys with their modifiers, and characters. Mouse motion is forwarded in screen coordinates.
+// The main windows are not affected, as their input goes through the backend.
+class ImGuiViewportEventListener final : public LLGL::Window::EventListener
+{
+public:
+    void OnLocalMotion(LLGL::Window& sender, const LLGL::Offset2D& position) override
+    {
+        if (auto* data = static_cast<ImGuiViewportData*>(sender.GetUserData()))
+            ImGuiViewports::OnMouseMotion(data->context, sender, position);
+    }
+
+    void OnKeyDown(LLGL::Window& sender, LLGL::Key keyCode) override
+    {
+        AddKeyEvent(sender, keyCode, true);
+    }
+
+    void OnKeyUp(LLGL::Window& sender, LLGL::Key keyCode) override
+    {
+        AddKeyEvent(sender, keyCode, false);
+    }
+
+    void OnChar(LLGL::Window& sender, wchar_t chr) override
+    {
+        ImGuiViewportContextScope scope{ sender };
+        if (ImGuiIO* io = scope.GetIO())
+            io->AddInputCharacter(static_cast<unsigned int>(chr));
+    }
+
+    void OnWheelMotion(LLGL::Window& sender, int motion) override
+    {
+        ImGuiViewportContextScope scope{ sender };
+        if (ImGuiIO* io = scope.GetIO())
+        {
+            io->AddMouseSourceEvent(ImGuiMouseSource_Mouse);
+            io->AddMouseWheelEvent(0.0f, static_cast<float>(motion));
+        }
+    }
+
+    void OnQuit(LLGL::Window& sender, bool& veto) override
+    {
+        // Closing a decorated viewport window docks its ImGui window back into the main viewport
+        veto = true;
+        if (auto* data = static_cast<ImGuiViewportData*>(sender.GetUserData()))
+            data->viewport->PlatformRequestClose = true;
+    }
+
+private:
+    void AddKeyEvent(LLGL::Window& sender, LLGL::Key keyCode, bool isDown)
+    {
+        ImGuiViewportContextScope scope{ sender };
+        ImGuiIO* io = scope.GetIO();
+        if (io == nullptr)
+            return;
+
+        const int mouseButton = ToImGuiMouseButton(keyCode);
+        if (mouseButton >= 0)
+        {
+            io->AddMouseSourceEvent(ImGuiMouseSource_Mouse);
+            io->AddMouseButtonEvent(mouseButton, isDown);
+            return;
+        }
+
+        const ImGuiKey key = ToImGuiKey(keyCode);
+        if (key == ImGuiKey_None)
+            return;
+
+        const ImGuiKey modifier = ToImGuiModifier(key);
+        if (modifier != ImGuiKey_None)
+            io->AddKeyEvent(modifier, isDown);
+        io->AddKeyEvent(key, isDown);
+    }
+};
+
+static const std::shared_ptr<ImGuiViewportEventListener>& GetViewportEventListener()
+{
+    static const std::shared_ptr<ImGuiViewportEventListener> listener = std::make_shared<ImGuiViewportEventListener>();
+    return listener;
+}
+
+struct ImGuiViewportsHooks
+{
+    static void CreatePlatformWindow(ImGuiViewport* viewport)
+    {
+        ImGuiViewports& self = ImGuiViewports::Get();
+
+        LLGL::SwapChainDescriptor desc = self.swapChainDesc;
+        desc.resolution = ToExtent(viewport->Size);
+
+        const bool isDecorated = ((viewport->Flags & ImGuiViewportFlags_NoDecoration) == 0);
+        LLGL::SwapChain* swapChain = self.pool.Acquire(desc, isDecorated);
+
+        // Secondary viewports must not wait for vsync, since they are presented one after another on the main thread
+        swapChain->SetVsyncInterval(0);
+
+        ImGuiViewportData* data = IM_NEW(ImGuiViewportData)();
+        {
+            data->swapChain = swapChain;
+            data->window    = &LLGL::CastTo<LLGL::Window>(swapChain->GetSurface());
+            data->context   = ImGui::GetCurrentContext();
+            data->viewport  = viewport;
+        }
+
+        data->window->SetUserData(data);
+        data->window->AddEventListener(GetViewportEventListener());
+        data->window->SetPosition(ToOffset(viewport->Pos));
+
+        viewport->PlatformUserData  = data;
+        viewport->RendererUserData  = data;
+        viewport->PlatformHandle    = data->window;
+    }
+
+    static void DestroyPlatformWindow(ImGuiViewport* viewport)
+    {
+        // The data of the main viewport is released by Uninstall(), since it keeps the previous hooks
+        ImGuiViewportData* data = GetViewportData(viewport);
+        if (data != nullptr && !data->isMain)
+        {
+            data->window->RemoveEventListener(GetViewportEventListener().get());
+            data->window->SetUserData(nullptr);
+            ImGuiViewports::Get().pool.Release(*data->swapChain);
+            IM_DELETE(data);
+            viewport->PlatformHandle = nullptr;
+        }
+        viewport->PlatformUserData = nullptr;
+        viewport->RendererUserData = nullptr;
+    }
+
+    static void ShowWindow(ImGuiViewport* viewport)
+    {
+        GetViewportData(viewport)->window->Show(true);
+    }
+
+    static void SetWindowPos(ImGuiViewport* viewport, ImVec2 pos)
+    {
+        GetViewportData(viewport)->window->SetPosition(ToOffset(pos));
+    }
+
+    static ImVec2 GetWindowPos(ImGuiViewport* viewport)
+    {
+        const LLGL::Offset2D pos = GetViewportData(viewport)->window->GetPosition();
+        return ImVec2{ static_cast<float>(pos.x), static_cast<float>(pos.y) };
+    }
+
+    static void SetWindowSize(ImGuiViewport* viewport, ImVec2 size)
+    {
+        GetViewportData(viewport)->window->SetSize(ToExtent(size));
+    }
+
+    static ImVec2 GetWindowSize(ImGuiViewport* viewport)
+    {
+        const LLGL::Extent2D size = GetViewportData(viewport)->window->GetSize();
+        return ImVec2{ static_cast<float>(size.width), static_cast<float>(size.height) };
+    }
+
+    static bool GetWindowFocus(ImGuiViewport* viewport)
+    {
+        return GetViewportData(viewport)->window->HasFocus();
+    }
+
+    static bool GetWindowMinimized(ImGuiViewport* viewport)
+    {
+        return !GetViewportData(viewport)->window->IsShown();
+    }
+
+    static void SetWindowTitle(ImGuiViewport* viewport, const char* title)
+    {
+        GetViewportData(viewport)->window->SetTitle(title);
+    }
+
+    static void ResizeSwapChain(ImGuiViewport* viewport, ImVec2 size)
+    {
+        LLGL::SwapChain* swapChain = GetViewportData(viewport)->swapChain;
+        swapChain->ResizeBuffers(ToExtent(size));
+        MemoryTracker::Get().TrackResource(swapChain, MemoryCategory::SwapChain, SwapChainPool::GetMemorySize(*swapChain), "Viewport.SwapChain");
+    }
+
+    static void RenderViewport(ImGuiViewport* viewport, void* /*renderArg*/)
+    {
+        ImGuiViewports::Get().renderFunc(*GetViewportData(viewport)->swapChain, viewport->DrawData);
+    }
+
+    static void PresentSwapChain(ImGuiViewport* viewport, void* /*renderArg*/)
+    {
+        GetViewportData(viewport)->swapChain->Present();
+    }
+};
+
+#endif // /IMGUI_HAS_VIEWPORT
+
+bool ImGuiViewports::IsSupported()
+{
+    #ifdef IMGUI_HAS_VIEWPORT
+    return true;
+    #else
+    return false;
+    #endif
+}
+
+bool ImGuiViewports::IsEnabled()
+{
+    #ifdef IMGUI_HAS_VIEWPORT
+    return ((ImGui::GetIO().ConfigFlags & ImGuiConfigFlags_ViewportsEnable) != 0);
+    #else
+    return false;
+    #endif
+}
+
+void ImGuiViewports::OnMouseMotion(ImGuiContext* context, LLGL::Window& window, const LLGL::Offset2D& positionInWindow)
+{
+    #ifdef IMGUI_HAS_VIEWPORT
+    ImGuiContext* prevContext = ImGui::GetCurrentContext();
+    ImGui::SetCurrentContext(context);
+    if (IsEnabled())
+    {
+        const LLGL::Offset2D windowPos = window.GetPosition();
+        ImGui::GetIO().AddMousePosEvent(
+            static_cast<float>(windowPos.x + positionInWindow.x),
+            static_cast<float>(windowPos.y + positionInWindow.y)
+        );
+    }
+    ImGui::SetCurrentContext(prevContext);
+    #endif
+}
+
+void ImGuiViewports::Init(const LLGL::SwapChainDescriptor& swapChainDesc, const RenderFunc& renderFunc)
+{
+    this->swapChainDesc = swapChainDesc;
+    this->renderFunc    = renderFunc;
+}
+
+void ImGuiViewports::Release()
+{
+    pool.Clear();
+    renderFunc = nullptr;
+}
+
+void ImGuiViewports::Install(LLGL::SwapChain& mainSwapChain)
+{
+    #ifdef IMGUI_HAS_VIEWPORT
+    ImGuiIO& io = ImGui::GetIO();
+    ImGuiPlatformIO& platformIO = ImGui::GetPlatformIO();
+    ImGuiViewport* mainViewport = ImGui::GetMainViewport();
+
+    // Main viewport keeps the previous state, so Uninstall() can restore it for the ImGui backends
+    ImGuiViewportData* mainData = IM_NEW(ImGuiViewportData)();
+    {
+        mainData->swapChain         = &mainSwapChain;
+        mainData->window            = &LLGL::CastTo<LLGL::Window>(mainSwapChain.GetSurface());
+        mainData->context           = ImGui::GetCurrentContext();
+        mainData->viewport          = mainViewport;
+        mainData->isMain            = true;
+        mainData->prevUserData      = mainViewport->PlatformUserData;
+        mainData->prevConfigFlags   = io.ConfigFlags;
+        mainData->prevBackendFlags  = io.BackendFlags;
+    }
+    mainViewport->PlatformUserData = mainData;
+
+    ImGuiPlatformIOHooks& hooks = mainData->prevHooks;
+    {
+        hooks.Platform_CreateWindow         = ImGuiViewportsHooks::CreatePlatformWindow;
+        hooks.Platform_DestroyWindow        = ImGuiViewportsHooks::DestroyPlatformWindow;
+        hooks.Platform_ShowWindow           = ImGuiViewportsHooks::ShowWindow;
+        hooks.Platform_SetWindowPos         = ImGuiViewportsHooks::SetWindowPos;
+        hooks.Platform_GetWindowPos         = ImGuiViewportsHooks::GetWindowPos;
+        hooks.Platform_SetWindowSize        = ImGuiViewportsHooks::SetWindowSize;
+        hooks.Platform_GetWindowSize        = ImGuiViewportsHooks::GetWindowSize;
+        hooks.Platform_GetWindowFocus       = ImGuiViewportsHooks::GetWindowFocus;
+        hooks.Platform_GetWindowMinimized   = ImGuiViewportsHooks::GetWindowMinimized;
+        hooks.Platform_SetWindowTitle       = ImGuiViewportsHooks::SetWindowTitle;
+        hooks.Renderer_SetWindowSize        = ImGuiViewportsHooks::ResizeSwapChain;
+        hooks.Renderer_RenderWindow         = ImGuiViewportsHooks::RenderViewport;
+        hooks.Renderer_SwapBuffers          = ImGuiViewportsHooks::PresentSwapChain;
+    }
+
+    // Swap our hooks in, which leaves the previous ones in 'prevHooks'
+    SwapHooks(platformIO, hooks);
+
+    io.ConfigFlags  |= ImGuiConfigFlags_ViewportsEnable;
+    io.BackendFlags |= ImGuiBackendFlags_PlatformHasViewports | ImGuiBackendFlags_RendererHasViewports;
+
+    UpdateMonitors();
+    #endif
+}
+
+void ImGuiViewports::Uninstall()
+{
+    #ifdef IMGUI_HAS_VIEWPORT
+    ImGuiViewport* mainViewport = ImGui::GetMainViewport();
+    ImGuiViewportData* mainData = GetViewportData(mainViewport);
+    if (mainData == nullptr || !mainData->isMain)
+        return;
+
+    // Destroying the platform windows also resets the user data of the main viewport
+    ImGui::DestroyPlatformWindows();
+
+    ImGuiIO& io = ImGui::GetIO();
+    {
+        SwapHooks(ImGui::GetPlatformIO(), mainData->prevHooks);
+        io.ConfigFlags  = mainData->prevConfigFlags;
+        io.BackendFlags = mainData->prevBackendFlags;
+        mainViewport->PlatformUserData = mainData->prevUserData;
+    }
+    IM_DELETE(mainData);
+    #endif
+}
+
+void ImGuiViewports::UpdatePlatformWindows()
+{
+    #ifdef IMGUI_HAS_VIEWPORT
+    if (!IsEnabled())
+        return;
+
+    // Update monitors for the next frame, since displays may have changed since the last one
+    UpdateMonitors();
+
+    ImGui::UpdatePlatformWindows();
+    ImGui::RenderPlatformWindowsDefault();
+    #endif
+}
+
+void ImGuiViewports::UpdateMonitors()
+{
+    #ifdef IMGUI_HAS_VIEWPORT
+    ImGuiPlatformIO& platformIO = ImGui::GetPlatformIO();
+    platformIO.Monitors.resize(0);
+
+    for (std::size_t i = 0, n = LLGL::Display::Count(); i < n; ++i)
+    {
+        const LLGL::Display* display = LLGL::Display::Get(i);
+        const LLGL::Offset2D offset = display->GetOffset();
+        const LLGL::Extent2D resolution = display->GetDisplayMode().resolution;
+
+        ImGuiPlatformMonitor monitor;
+        {
+            monitor.MainPos     = ImVec2{ static_cast<float>(offset.x), static_cast<float>(offset.y) };
+            monitor.MainSize    = ImVec2{ static_cast<float>(resolution.width), static_cast<float>(resolution.height) };
+            monitor.WorkPos     = monitor.MainPos;
+            monitor.WorkSize    = monitor.MainSize;
+            monitor.DpiScale    = display->GetScale();
+        }
+
+        // ImGui expects the primary display first
+        if (display->IsPrimary())
+            platformIO.Monitors.push_front(monitor);
+        else
+            platformIO.Monitors.push_back(monitor);
+    }
+    #endif
+}
+
@@ -0,0 +1,75 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * ImGuiViewports.h
+ */
+
+#pragma once
+
+#include <LLGL/LLGL.h>
+#include "SwapChainPool.h"
+#include "imgui.h"
+#include <functional>
+
+
+// Multi-viewport support for ImGui, i.e. ImGui windows that are dragged out of their main window get their own
+// platform window. These windows are backed by swap chains from a SwapChainPool and rendered with the regular
+// backend, so this replaces the platform and renderer hooks of the ImGui backends for all graphics APIs alike.
+// Requires the docking branch of ImGui; otherwise IsSupported() returns false and nothing is installed.
+class ImGuiViewports
+{
+public:
+    // Records and submits the draw data of a secondary viewport into its swap chain; presenting is done here.
+    using RenderFunc = std::function<void(LLGL::SwapChain& swapChain, ImDrawData* drawData)>;
+
+public:
+    static ImGuiViewports& Get();
+
+    // Returns true if ImGui was built with viewport support.
+    static bool IsSupported();
+
+    // Returns true if multi-viewports are enabled for the current ImGui context.
+    static bool IsEnabled();
+
+    // Forwards the mouse position within a window of an ImGui context in screen coordinates if that context has multi-viewports enabled.
+    static void OnMouseMotion(ImGuiContext* context, LLGL::Window& window, const LLGL::Offset2D& positionInWindow);
+
+    // Sets the formats of the swap chains for secondary viewports and the function to render them.
+    void Init(const LLGL::SwapChainDescriptor& swapChainDesc, const RenderFunc& renderFunc);
+
+    // Destroys all pooled swap chains; all contexts must have been uninstalled first.
+    void Release();
+
+    // Enables multi-viewports for the current ImGui context whose main viewport is presented by 'mainSwapChain'.
+    // Must be called after the ImGui backends of that context have been initialized.
+    void Install(LLGL::SwapChain& mainSwapChain);
+
+    // Destroys the secondary viewports of the current ImGui context and restores the hooks of its ImGui backends.
+    // Must be called before these backends shut down.
+    void Uninstall();
+
+    // Creates, moves, and destroys the platform windows of the current ImGui context, then renders and presents them.
+    // Must be called after ImGui::Render().
+    void UpdatePlatformWindows();
+
+    SwapChainPool::Stats GetPoolStats() const
+    {
+        return pool.GetStats();
+    }
+
+private:
+    ImGuiViewports() = default;
+
+    // Updates the list of monitors of the current ImGui context from the LLGL displays.
+    static void UpdateMonitors();
+
+private:
+    SwapChainPool               pool;
+    LLGL::SwapChainDescriptor   swapChainDesc;
+    RenderFunc                  renderFunc;
+
+    friend struct ImGuiViewportsHooks;
+};
+
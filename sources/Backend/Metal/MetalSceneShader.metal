@@ -18,6 +18,12 @@ struct View
     float4   lightVector;
 };
 
+struct Object
+{
+    float4x4 objectMatrix;
+    float4   objectColor;
+};
+
 struct VertexIn
 {
     float3 position [[attribute(0)]];
@@ -33,13 +39,14 @@ struct VertexOut
 };
 
 vertex VertexOut VSMain(
-    VertexIn       inp  [[stage_in]],
-    constant View& view [[buffer(1)]])
+    VertexIn         inp  [[stage_in]],
+    constant View&   view [[buffer(1)]],
+    constant Object& obj  [[buffer(2)]])
 {
     VertexOut outp;
-    outp.position   = view.vpMatrix * (view.wMatrix * float4(inp.position, 1));
-    outp.normal     = normalize((view.wMatrix * float4(inp.normal, 0)).xyz);
-    outp.color      = view.modelColor * inp.color;
+    outp.position   = view.vpMatrix * (view.wMatrix * (obj.objectMatrix * float4(inp.position, 1)));
+    outp.normal     = normalize((view.wMatrix * (obj.objectMatrix * float4(inp.normal, 0))).xyz);
+    outp.color      = view.modelColor * obj.objectColor * inp.color;
     return outp;
 }
 
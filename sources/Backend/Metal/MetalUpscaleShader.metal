@@ -0,0 +1,37 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * Metal Upscale Shader
+ */
+
+#include <metal_stdlib>
+
+using namespace metal;
+
+struct VertexOut
+{
+    float4 position [[position]];
+    float2 texCoord;
+};
+
+vertex VertexOut VSMain(uint id [[vertex_id]])
+{
+    // Full-screen triangle from the vertex ID; texture rows start at the top
+    float2 position = float2(float((id & 1) * 4) - 1.0, float((id & 2) * 2) - 1.0);
+
+    VertexOut outp;
+    outp.position   = float4(position, 0, 1);
+    outp.texCoord   = float2(position.x * 0.5 + 0.5, 0.5 - position.y * 0.5);
+    return outp;
+}
+
+fragment float4 PSMain(
+    VertexOut        inp             [[stage_in]],
+    texture2d<float> colorMap        [[texture(0)]],
+    sampler          colorMapSampler [[sampler(1)]])
+{
+    return colorMap.sample(colorMapSampler, inp.texCoord);
+}
+
@@ -0,0 +1,54 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * Null Backend
+ */
+
+#include "../Backend.h"
+#include "../../Globals.h"
+
+#include <LLGL/LLGL.h>
+
+#include "imgui.h"
+
+class NullBackend final : public Backend
+{
+public:
+
+    NullBackend()
+    {
+        // The Null renderer does not compile shaders, so it borrows the GLSL sources of the OpenGL backend
+        CreateResources(
+            "Null",
+
+            // Vertex shader
+            "../OpenGL/OpenGLSceneShader.vert",
+            nullptr,
+            nullptr,
+
+            // Pixel shader
+            "../OpenGL/OpenGLSceneShader.frag",
+            nullptr,
+            nullptr
+        );
+    }
+
+    void BeginFrame(WindowContext& context) override
+    {
+        Backend::BeginFrame(context);
+
+        // Not every platform backend of ImGui updates the display size, and there is no renderer backend to do so
+        const LLGL::Extent2D resolution = context.swapChain->GetResolution();
+        ImGui::GetIO().DisplaySize = ImVec2{ static_cast<float>(resolution.width), static_cast<float>(resolution.height) };
+    }
+
+    void EndFrame(ImDrawData* /*data*/) override
+    {
+        // Nothing to render
+    }
+};
+
+REGISTER_BACKEND(NullBackend, "Null");
+
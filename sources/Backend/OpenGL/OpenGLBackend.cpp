@@ -11,12 +11,270 @@
 
 #include <LLGL/LLGL.h>
 #include <LLGL/Platform/NativeHandle.h>
+#include <LLGL/Backend/OpenGL/NativeCommand.h>
 
 #include "imgui.h"
 #include "imgui_impl_opengl3.h"
+#include "OpenGLStateShadow.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+static const char* g_imGuiVertexShaderSource =
+    "#version 330 core\n"
+    "uniform mat4 projection;\n"
+    "layout(location = 0) in vec2 position;\n"
+    "layout(location = 1) in vec2 texCoord;\n"
+    "layout(location = 2) in vec4 color;\n"
+    "out vec2 vTexCoord;\n"
+    "out vec4 vColor;\n"
+    "void main()\n"
+    "{\n"
+    "    vTexCoord = texCoord;\n"
+    "    vColor = color;\n"
+    "    gl_Position = projection * vec4(position, 0, 1);\n"
+    "}\n";
+
+static const char* g_imGuiFragmentShaderSource =
+    "#version 330 core\n"
+    "uniform sampler2D colorMap;\n"
+    "in vec2 vTexCoord;\n"
+    "in vec4 vColor;\n"
+    "layout(location = 0) out vec4 outColor;\n"
+    "void main()\n"
+    "{\n"
+    "    outColor = vColor * texture(colorMap, vTexCoord);\n"
+    "}\n";
+
+static GLuint CompileImGuiShader(GLenum type, const char* source)
+{
+    GLuint shader = glCreateShader(type);
+    glShaderSource(shader, 1, &source, nullptr);
+    glCompileShader(shader);
+
+    GLint status = GL_FALSE;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
+    if (status == GL_FALSE)
+    {
+        char infoLog[1024] = {};
+        glGetShaderInfoLog(shader, sizeof(infoLog), nullptr, infoLog);
+        LLGL::Log::Errorf(LLGL::Log::ColorFlags::StdError, "Failed to compile ImGui shader:\n%s\n", infoLog);
+    }
+
+    return shader;
+}
+
+// Renders ImGui draw data with its own GL objects and an OpenGLStateShadow, so it neither queries nor restores GL state.
+// GL objects are created lazily inside the window's GL context, since vertex arrays are not shared between contexts.
+class OpenGLImGuiRenderer
+{
+public:
+    void Release()
+    {
+        if (program != 0)
+            glDeleteProgram(program);
+        if (vertexArray != 0)
+            glDeleteVertexArrays(1, &vertexArray);
+        if (vertexBuffer != 0)
+            glDeleteBuffers(1, &vertexBuffer);
+        if (indexBuffer != 0)
+            glDeleteBuffers(1, &indexBuffer);
+        program = vertexArray = vertexBuffer = indexBuffer = 0;
+    }
+
+    void RenderDrawData(ImDrawData* data)
+    {
+        const int fbWidth = static_cast<int>(data->DisplaySize.x * data->FramebufferScale.x);
+        const int fbHeight = static_cast<int>(data->DisplaySize.y * data->FramebufferScale.y);
+        if (fbWidth <= 0 || fbHeight <= 0)
+            return;
+
+        if (program == 0)
+            CreateDeviceObjects();
+
+        #if IMGUI_VERSION_NUM >= 19200
+        // Since ImGui 1.92, textures such as the font atlas are only created and updated while rendering the draw data.
+        // The stock backend uploads them; it changes texture bindings, which the shadow forgets right below anyway.
+        if (data->Textures != nullptr)
+        {
+            for (ImTextureData* texture : *data->Textures)
+            {
+                if (texture->Status != ImTextureStatus_OK)
+                    ImGui_ImplOpenGL3_UpdateTexture(texture);
+            }
+        }
+        #endif
+
+        // LLGL has changed GL state since the last frame, so nothing that is shadowed can be trusted
+        stateShadow.Invalidate();
+
+        SetupRenderState(data, fbWidth, fbHeight);
+
+        const ImVec2 clipOffset = data->DisplayPos;
+        const ImVec2 clipScale  = data->FramebufferScale;
+
+        for (int n = 0; n < data->CmdListsCount; ++n)
+        {
+            const ImDrawList* drawList = data->CmdLists[n];
+
+            // Orphan the previous buffer storage, so the driver does not have to wait for pending draws
+            glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(drawList->VtxBuffer.Size) * sizeof(ImDrawVert), drawList->VtxBuffer.Data, GL_STREAM_DRAW);
+            glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(drawList->IdxBuffer.Size) * sizeof(ImDrawIdx), drawList->IdxBuffer.Data, GL_STREAM_DRAW);
+
+            for (int i = 0; i < drawList->CmdBuffer.Size; ++i)
+            {
+                const ImDrawCmd& cmd = drawList->CmdBuffer[i];
+                if (cmd.UserCallback != nullptr)
+                {
+                    if (cmd.UserCallback == ImDrawCallback_ResetRenderState)
+                        SetupRenderState(data, fbWidth, fbHeight);
+                    else
+                        cmd.UserCallback(drawList, &cmd);
+                    continue;
+                }
+
+                const ImVec2 clipMin{ (cmd.ClipRect.x - clipOffset.x) * clipScale.x, (cmd.ClipRect.y - clipOffset.y) * clipScale.y };
+                const ImVec2 clipMax{ (cmd.ClipRect.z - clipOffset.x) * clipScale.x, (cmd.ClipRect.w - clipOffset.y) * clipScale.y };
+                if (clipMax.x <= clipMin.x || clipMax.y <= clipMin.y)
+                    continue;
+
+                // Scissor rectangles have their origin at the lower-left corner in GL
+                stateShadow.SetScissor(
+                    static_cast<GLint>(clipMin.x),
+                    static_cast<GLint>(static_cast<float>(fbHeight) - clipMax.y),
+                    static_cast<GLsizei>(clipMax.x - clipMin.x),
+                    static_cast<GLsizei>(clipMax.y - clipMin.y)
+                );
+                stateShadow.BindTexture2D(static_cast<GLuint>(reinterpret_cast<std::intptr_t>(cmd.GetTexID())));
+
+                glDrawElementsBaseVertex(
+                    GL_TRIANGLES,
+                    static_cast<GLsizei>(cmd.ElemCount),
+                    (sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT),
+                    reinterpret_cast<const void*>(static_cast<std::intptr_t>(cmd.IdxOffset * sizeof(ImDrawIdx))),
+                    static_cast<GLint>(cmd.VtxOffset)
+                );
+            }
+        }
+    }
+
+    // Disables the scissor test and blending and unbinds the program and vertex array that RenderDrawData() has left behind,
+    // so no later GL command of LLGL is clipped, blended, or sourced from the ImGui vertex array by accident.
+    void ResetRenderState()
+    {
+        stateShadow.SetEnabled(OpenGLStateShadow::CapScissorTest, false);
+        stateShadow.SetEnabled(OpenGLStateShadow::CapBlend, false);
+        stateShadow.UseProgram(0);
+        stateShadow.BindVertexArray(0);
+    }
+
+    const OpenGLStateShadow& GetStateShadow() const
+    {
+        return stateShadow;
+    }
+
+    void ResetCounters()
+    {
+        stateShadow.ResetCounters();
+    }
+
+private:
+    void CreateDeviceObjects()
+    {
+        GLuint vertShader = CompileImGuiShader(GL_VERTEX_SHADER, g_imGuiVertexShaderSource);
+        GLuint fragShader = CompileImGuiShader(GL_FRAGMENT_SHADER, g_imGuiFragmentShaderSource);
+
+        program = glCreateProgram();
+        glAttachShader(program, vertShader);
+        glAttachShader(program, fragShader);
+        glLinkProgram(program);
+        glDetachShader(program, vertShader);
+        glDetachShader(program, fragShader);
+        glDeleteShader(vertShader);
+        glDeleteShader(fragShader);
+
+        projectionLocation = glGetUniformLocation(program, "projection");
+
+        // Sampler and vertex layout never change, so they are set once here instead of every frame
+        stateShadow.Invalidate();
+        stateShadow.UseProgram(program);
+        glUniform1i(glGetUniformLocation(program, "colorMap"), 0);
+
+        glGenBuffers(1, &vertexBuffer);
+        glGenBuffers(1, &indexBuffer);
+        glGenVertexArrays(1, &vertexArray);
+
+        stateShadow.BindVertexArray(vertexArray);
+        stateShadow.BindArrayBuffer(vertexBuffer);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+
+        glEnableVertexAttribArray(0);
+        glEnableVertexAttribArray(1);
+        glEnableVertexAttribArray(2);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(ImDrawVert), reinterpret_cast<const void*>(offsetof(ImDrawVert, pos)));
+        glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(ImDrawVert), reinterpret_cast<const void*>(offsetof(ImDrawVert, uv)));
+        glVertexAttribPointer(2, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(ImDrawVert), reinterpret_cast<const void*>(offsetof(ImDrawVert, col)));
+    }
+
+    void SetupRenderState(ImDrawData* data, int fbWidth, int fbHeight)
+    {
+        stateShadow.SetEnabled(OpenGLStateShadow::CapBlend, true);
+        stateShadow.SetBlendEquation(GL_FUNC_ADD);
+        stateShadow.SetBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+        stateShadow.SetEnabled(OpenGLStateShadow::CapCullFace, false);
+        stateShadow.SetEnabled(OpenGLStateShadow::CapDepthTest, false);
+        stateShadow.SetEnabled(OpenGLStateShadow::CapStencilTest, false);
+        stateShadow.SetEnabled(OpenGLStateShadow::CapScissorTest, true);
+        stateShadow.SetEnabled(OpenGLStateShadow::CapPrimitiveRestart, false);
+        stateShadow.SetPolygonMode(GL_FILL);
+        stateShadow.SetViewport(0, 0, static_cast<GLsizei>(fbWidth), static_cast<GLsizei>(fbHeight));
+
+        // Orthographic projection with the origin at the top-left corner of the display
+        const float l = data->DisplayPos.x;
+        const float r = data->DisplayPos.x + data->DisplaySize.x;
+        const float t = data->DisplayPos.y;
+        const float b = data->DisplayPos.y + data->DisplaySize.y;
+        const float projection[4][4] =
+        {
+            { 2.0f/(r - l),     0.0f,               0.0f,   0.0f },
+            { 0.0f,             2.0f/(t - b),       0.0f,   0.0f },
+            { 0.0f,             0.0f,              -1.0f,   0.0f },
+            { (r + l)/(l - r),  (t + b)/(b - t),    0.0f,   1.0f },
+        };
+
+        stateShadow.UseProgram(program);
+        glUniformMatrix4fv(projectionLocation, 1, GL_FALSE, &projection[0][0]);
+
+        stateShadow.SetActiveTexture(GL_TEXTURE0);
+        stateShadow.BindSampler(0);
+        stateShadow.BindVertexArray(vertexArray);
+        stateShadow.BindArrayBuffer(vertexBuffer);
+    }
+
+private:
+    OpenGLStateShadow   stateShadow;
+    GLuint              program             = 0;
+    GLuint              vertexArray         = 0;
+    GLuint              vertexBuffer        = 0;
+    GLuint              indexBuffer         = 0;    // Bound to 'vertexArray'
+    GLint               projectionLocation  = -1;
+};
 
 class OpenGLBackend final : public Backend
 {
+    struct ImGuiRenderStats
+    {
+        std::uint64_t   numFrames       = 0;
+        std::uint64_t   renderTicks     = 0;    // Total CPU time of EndFrame()
+        std::uint64_t   numChanges      = 0;    // Total number of GL state changes issued by the state shadow
+        std::uint64_t   numSkipped      = 0;    // Total number of redundant GL state changes skipped by the state shadow
+    };
+
+    std::vector<OpenGLImGuiRenderer>    imGuiRenderers;         // One per window, since GL objects are per context
+    std::vector<ImGuiRenderStats>       imGuiRenderStats;
+    int                                 currentWindowIndex      = 0;
+
 public:
 
     OpenGLBackend()
@@ -40,13 +298,42 @@ public:
     {
         Backend::InitContext(context);
 
+        // The ImGui backend still loads GL functions and creates the font texture
         ImGui_ImplOpenGL3_Init();
+
+        const std::size_t numWindows = static_cast<std::size_t>(context.windowIndex) + 1;
+        if (imGuiRenderers.size() < numWindows)
+        {
+            imGuiRenderers.resize(numWindows);
+            imGuiRenderStats.resize(numWindows);
+        }
     }
 
     void ReleaseContext(WindowContext& context) override
     {
         ImGui::SetCurrentContext(context.imGuiContext);
 
+        const ImGuiRenderStats& stats = imGuiRenderStats[context.windowIndex];
+        if (stats.numFrames > 0)
+        {
+            const double avgTime = static_cast<double>(stats.renderTicks) / static_cast<double>(stats.numFrames) / static_cast<double>(LLGL::Timer::Frequency());
+            LLGL::Log::Printf(
+                "OpenGL ImGui rendering in window %d: %.3f ms/frame with %s",
+                context.windowIndex, avgTime * 1000.0, (options.shadowGLState ? "state shadowing" : "ImGui state backup")
+            );
+            if (options.shadowGLState)
+            {
+                LLGL::Log::Printf(
+                    ", %.1f GL state changes and %.1f skipped per frame",
+                    static_cast<double>(stats.numChanges) / static_cast<double>(stats.numFrames),
+                    static_cast<double>(stats.numSkipped) / static_cast<double>(stats.numFrames)
+                );
+            }
+            LLGL::Log::Printf("\n");
+        }
+
+        imGuiRenderers[context.windowIndex].Release();
+
         ImGui_ImplOpenGL3_Shutdown();
 
         Backend::ReleaseContext(context);
@@ -57,11 +344,38 @@ public:
         Backend::BeginFrame(context);
 
         ImGui_ImplOpenGL3_NewFrame();
+
+        currentWindowIndex = context.windowIndex;
     }
 
     void EndFrame(ImDrawData* data) override
     {
-        ImGui_ImplOpenGL3_RenderDrawData(data);
+        const std::uint64_t startTick = LLGL::Timer::Tick();
+
+        ImGuiRenderStats& stats = imGuiRenderStats[currentWindowIndex];
+
+        if (options.shadowGLState)
+        {
+            OpenGLImGuiRenderer& imGuiRenderer = imGuiRenderers[currentWindowIndex];
+            imGuiRenderer.RenderDrawData(data);
+            imGuiRenderer.ResetRenderState();
+
+            // Let LLGL re-establish the rest of the state it needs on its next commands instead of restoring all of it here
+            LLGL::OpenGL::NativeCommand nativeCmd;
+            {
+                nativeCmd.type = LLGL::OpenGL::NativeCommandType::ClearCache;
+            }
+            cmdBuffer->DoNativeCommand(&nativeCmd, sizeof(nativeCmd));
+
+            stats.numChanges += imGuiRenderer.GetStateShadow().GetNumChanges();
+            stats.numSkipped += imGuiRenderer.GetStateShadow().GetNumSkipped();
+            imGuiRenderer.ResetCounters();
+        }
+        else
+            ImGui_ImplOpenGL3_RenderDrawData(data);
+
+        stats.renderTicks += LLGL::Timer::Tick() - startTick;
+        stats.numFrames++;
     }
 };
 
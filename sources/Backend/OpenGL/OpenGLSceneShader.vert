@@ -16,6 +16,12 @@ layout(std140) uniform View
     vec4 lightVector;
 };
 
+layout(std140) uniform Object
+{
+    mat4 objectMatrix;
+    vec4 objectColor;
+};
+
 in vec3 position;
 in vec3 normal;
 in vec4 color;
@@ -25,7 +31,7 @@ out vec4 vColor;
 
 void main()
 {
-    gl_Position = vpMatrix * (wMatrix * vec4(position, 1));
-    vNormal     = normalize(mat3(wMatrix) * normal);
-    vColor      = modelColor * color;
+    gl_Position = vpMatrix * (wMatrix * (objectMatrix * vec4(position, 1)));
+    vNormal     = normalize(mat3(wMatrix) * (mat3(objectMatrix) * normal));
+    vColor      = modelColor * objectColor * color;
 }
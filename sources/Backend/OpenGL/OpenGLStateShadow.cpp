@@ -0,0 +1,176 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * OpenGLStateShadow.cpp
+ */
+
+#include "OpenGLStateShadow.h"
+
+
+static const GLenum g_capabilityEnums[OpenGLStateShadow::CapCount] =
+{
+    GL_BLEND,
+    GL_CULL_FACE,
+    GL_DEPTH_TEST,
+    GL_STENCIL_TEST,
+    GL_SCISSOR_TEST,
+    GL_PRIMITIVE_RESTART,
+};
+
+void OpenGLStateShadow::Invalidate()
+{
+    validBits = 0;
+}
+
+void OpenGLStateShadow::SetEnabled(Capability cap, bool enabled)
+{
+    if (IsRedundant(1u << cap, capabilities[cap] == enabled))
+        return;
+
+    capabilities[cap] = enabled;
+    if (enabled)
+        glEnable(g_capabilityEnums[cap]);
+    else
+        glDisable(g_capabilityEnums[cap]);
+}
+
+void OpenGLStateShadow::SetBlendEquation(GLenum mode)
+{
+    if (IsRedundant(StateBlendEquation, blendEquation == mode))
+        return;
+
+    blendEquation = mode;
+    glBlendEquation(mode);
+}
+
+void OpenGLStateShadow::SetBlendFuncSeparate(GLenum srcColor, GLenum dstColor, GLenum srcAlpha, GLenum dstAlpha)
+{
+    const bool isEqual =
+    (
+        blendFunc[0] == srcColor &&
+        blendFunc[1] == dstColor &&
+        blendFunc[2] == srcAlpha &&
+        blendFunc[3] == dstAlpha
+    );
+    if (IsRedundant(StateBlendFunc, isEqual))
+        return;
+
+    blendFunc[0] = srcColor;
+    blendFunc[1] = dstColor;
+    blendFunc[2] = srcAlpha;
+    blendFunc[3] = dstAlpha;
+    glBlendFuncSeparate(srcColor, dstColor, srcAlpha, dstAlpha);
+}
+
+void OpenGLStateShadow::SetPolygonMode(GLenum mode)
+{
+    if (IsRedundant(StatePolygonMode, polygonMode == mode))
+        return;
+
+    polygonMode = mode;
+    glPolygonMode(GL_FRONT_AND_BACK, mode);
+}
+
+void OpenGLStateShadow::SetViewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    const bool isEqual = (viewport[0] == x && viewport[1] == y && viewport[2] == width && viewport[3] == height);
+    if (IsRedundant(StateViewport, isEqual))
+        return;
+
+    viewport[0] = x;
+    viewport[1] = y;
+    viewport[2] = width;
+    viewport[3] = height;
+    glViewport(x, y, width, height);
+}
+
+void OpenGLStateShadow::SetScissor(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    const bool isEqual = (scissor[0] == x && scissor[1] == y && scissor[2] == width && scissor[3] == height);
+    if (IsRedundant(StateScissor, isEqual))
+        return;
+
+    scissor[0] = x;
+    scissor[1] = y;
+    scissor[2] = width;
+    scissor[3] = height;
+    glScissor(x, y, width, height);
+}
+
+void OpenGLStateShadow::UseProgram(GLuint newProgram)
+{
+    if (IsRedundant(StateProgram, program == newProgram))
+        return;
+
+    program = newProgram;
+    glUseProgram(newProgram);
+}
+
+void OpenGLStateShadow::BindVertexArray(GLuint newVertexArray)
+{
+    if (IsRedundant(StateVertexArray, vertexArray == newVertexArray))
+        return;
+
+    vertexArray = newVertexArray;
+    glBindVertexArray(newVertexArray);
+}
+
+void OpenGLStateShadow::BindArrayBuffer(GLuint buffer)
+{
+    if (IsRedundant(StateArrayBuffer, arrayBuffer == buffer))
+        return;
+
+    arrayBuffer = buffer;
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+}
+
+void OpenGLStateShadow::SetActiveTexture(GLenum textureUnit)
+{
+    if (IsRedundant(StateActiveTexture, activeTexture == textureUnit))
+        return;
+
+    // Texture and sampler bindings are per texture unit
+    validBits &= ~(StateTexture2D | StateSampler);
+
+    activeTexture = textureUnit;
+    glActiveTexture(textureUnit);
+}
+
+void OpenGLStateShadow::BindTexture2D(GLuint texture)
+{
+    if (IsRedundant(StateTexture2D, texture2D == texture))
+        return;
+
+    texture2D = texture;
+    glBindTexture(GL_TEXTURE_2D, texture);
+}
+
+void OpenGLStateShadow::BindSampler(GLuint newSampler)
+{
+    if (IsRedundant(StateSampler, sampler == newSampler))
+        return;
+
+    sampler = newSampler;
+    glBindSampler(static_cast<GLuint>(activeTexture - GL_TEXTURE0), newSampler);
+}
+
+void OpenGLStateShadow::ResetCounters()
+{
+    numChanges = 0;
+    numSkipped = 0;
+}
+
+bool OpenGLStateShadow::IsRedundant(std::uint32_t stateBit, bool isEqual)
+{
+    if ((validBits & stateBit) != 0 && isEqual)
+    {
+        ++numSkipped;
+        return true;
+    }
+    validBits |= stateBit;
+    ++numChanges;
+    return false;
+}
+
@@ -0,0 +1,101 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * OpenGLStateShadow.h
+ */
+
+#pragma once
+
+#include "imgui_impl_opengl3_loader.h"
+#include <cstdint>
+
+
+// Shadows the OpenGL state that the ImGui renderer changes, so redundant state changes are skipped without
+// querying the driver. All values are unknown after Invalidate(), which must be called whenever other code,
+// such as LLGL, may have changed the state since the last call.
+class OpenGLStateShadow
+{
+public:
+    enum Capability
+    {
+        CapBlend = 0,
+        CapCullFace,
+        CapDepthTest,
+        CapStencilTest,
+        CapScissorTest,
+        CapPrimitiveRestart,
+
+        CapCount,
+    };
+
+public:
+    void Invalidate();
+
+    void SetEnabled(Capability cap, bool enabled);
+    void SetBlendEquation(GLenum mode);
+    void SetBlendFuncSeparate(GLenum srcColor, GLenum dstColor, GLenum srcAlpha, GLenum dstAlpha);
+    void SetPolygonMode(GLenum mode);
+    void SetViewport(GLint x, GLint y, GLsizei width, GLsizei height);
+    void SetScissor(GLint x, GLint y, GLsizei width, GLsizei height);
+    void UseProgram(GLuint program);
+    void BindVertexArray(GLuint vertexArray);
+    void BindArrayBuffer(GLuint buffer);
+    void SetActiveTexture(GLenum textureUnit);
+    void BindTexture2D(GLuint texture);
+    void BindSampler(GLuint sampler);
+
+    // Returns the number of state changes that were passed to GL since the last call of ResetCounters().
+    std::uint32_t GetNumChanges() const
+    {
+        return numChanges;
+    }
+
+    // Returns the number of state changes that were skipped since the last call of ResetCounters().
+    std::uint32_t GetNumSkipped() const
+    {
+        return numSkipped;
+    }
+
+    void ResetCounters();
+
+private:
+    enum StateBit : std::uint32_t
+    {
+        StateBlendEquation  = (1u << CapCount),
+        StateBlendFunc      = (StateBlendEquation   << 1),
+        StatePolygonMode    = (StateBlendFunc       << 1),
+        StateViewport       = (StatePolygonMode     << 1),
+        StateScissor        = (StateViewport        << 1),
+        StateProgram        = (StateScissor         << 1),
+        StateVertexArray    = (StateProgram         << 1),
+        StateArrayBuffer    = (StateVertexArray     << 1),
+        StateActiveTexture  = (StateArrayBuffer     << 1),
+        StateTexture2D      = (StateActiveTexture   << 1),
+        StateSampler        = (StateTexture2D       << 1),
+    };
+
+private:
+    // Returns true if the state is known to have the specified value; otherwise, marks it as known and counts the change.
+    bool IsRedundant(std::uint32_t stateBit, bool isEqual);
+
+private:
+    std::uint32_t   validBits           = 0;    // Bit mask of states whose shadow value matches GL
+    std::uint32_t   numChanges          = 0;
+    std::uint32_t   numSkipped          = 0;
+
+    bool            capabilities[CapCount]  = {};
+    GLenum          blendEquation       = 0;
+    GLenum          blendFunc[4]        = {};
+    GLenum          polygonMode         = 0;
+    GLint           viewport[4]         = {};
+    GLint           scissor[4]          = {};
+    GLuint          program             = 0;
+    GLuint          vertexArray         = 0;
+    GLuint          arrayBuffer         = 0;
+    GLenum          activeTexture       = 0;
+    GLuint          texture2D           = 0;    // Binding of the active texture unit
+    GLuint          sampler             = 0;    // Binding of the active texture unit
+};
+
@@ -0,0 +1,21 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * OpenGL Upscale Fragment Shader
+ */
+
+#version 330 core
+
+uniform sampler2D colorMap;
+
+in vec2 vTexCoord;
+
+out vec4 outColor;
+
+void main()
+{
+    outColor = texture(colorMap, vTexCoord);
+}
+
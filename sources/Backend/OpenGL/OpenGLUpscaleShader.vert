@@ -0,0 +1,20 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * OpenGL Upscale Vertex Shader
+ */
+
+#version 330 core
+
+out vec2 vTexCoord;
+
+void main()
+{
+    // Full-screen triangle from the vertex ID
+    vec2 position = vec2(float((gl_VertexID & 1) * 4 - 1), float((gl_VertexID & 2) * 2 - 1));
+    gl_Position = vec4(position, 0, 1);
+    vTexCoord   = position * 0.5 + 0.5;
+}
+
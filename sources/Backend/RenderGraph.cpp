@@ -0,0 +1,487 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * RenderGraph.cpp
+ */
+
+#include "RenderGraph.h"
+#include "../Globals.h"
+#include "../MemoryTracker.h"
+#include <LLGL/Log.h>
+#include <algorithm>
+
+
+RenderGraph::RenderGraph(int inWindowIndex, LLGL::PipelineLayout* inSampleLayout, LLGL::Sampler* inSampler) :
+    windowIndex  { inWindowIndex  },
+    sampleLayout { inSampleLayout },
+    sampler      { inSampler      }
+{
+}
+
+RenderGraph::~RenderGraph()
+{
+    ReleaseTargets();
+    for (CachedRenderPass& entry : renderPasses)
+        renderer->Release(*entry.renderPass);
+}
+
+void RenderGraph::ReserveTarget(const TargetDesc& desc, std::uint32_t count)
+{
+    for (const PhysicalTarget& target : physicalTargets)
+    {
+        if (count > 0 && IsTargetDescEqual(target.desc, desc))
+            --count;
+    }
+
+    for (; count > 0; --count)
+        physicalTargets.push_back(CreatePhysicalTarget(desc));
+
+    CreateRenderPasses(desc.colorFormat, desc.depthStencilFormat, 1);
+}
+
+void RenderGraph::ReserveSwapChain(const LLGL::SwapChain& swapChain)
+{
+    CreateRenderPasses(swapChain.GetColorFormat(), swapChain.GetDepthStencilFormat(), swapChain.GetSamples());
+}
+
+void RenderGraph::Begin()
+{
+    resources.clear();
+    passes.clear();
+    batches.clear();
+    ++frame;
+}
+
+RenderGraph::ResourceID RenderGraph::ImportSwapChain(LLGL::SwapChain& swapChain)
+{
+    Resource resource;
+    {
+        resource.desc.debugName             = "SwapChain";
+        resource.desc.resolution            = swapChain.GetResolution();
+        resource.desc.colorFormat           = swapChain.GetColorFormat();
+        resource.desc.depthStencilFormat    = swapChain.GetDepthStencilFormat();
+        resource.swapChain                  = &swapChain;
+    }
+    resources.push_back(resource);
+    return static_cast<ResourceID>(resources.size() - 1);
+}
+
+RenderGraph::ResourceID RenderGraph::CreateTarget(const TargetDesc& desc)
+{
+    Resource resource;
+    {
+        resource.desc = desc;
+    }
+    resources.push_back(resource);
+    return static_cast<ResourceID>(resources.size() - 1);
+}
+
+RenderGraph::PassID RenderGraph::AddPass(const char* name, const ExecuteFunc& execute)
+{
+    Pass pass;
+    {
+        pass.name       = name;
+        pass.execute    = execute;
+    }
+    passes.push_back(std::move(pass));
+    return static_cast<PassID>(passes.size() - 1);
+}
+
+void RenderGraph::Write(PassID pass, ResourceID target, LoadAction action, const LLGL::ClearValue& clearColor)
+{
+    passes[pass].target     = target;
+    passes[pass].action     = action;
+    passes[pass].clearColor = clearColor;
+}
+
+void RenderGraph::Read(PassID pass, ResourceID target)
+{
+    passes[pass].reads.push_back(target);
+}
+
+void RenderGraph::Execute(LLGL::CommandBuffer& cmdBuffer)
+{
+    CullPasses();
+    BuildBatches();
+    AssignPhysicalTargets();
+
+    for (const Batch& batch : batches)
+    {
+        const Resource& target = resources[batch.target];
+        if (target.swapChain == nullptr && target.physicalIndex == invalidID)
+            continue;
+
+        const bool hasDepthStencil = (target.desc.depthStencilFormat != LLGL::Format::Undefined);
+
+        // Clear values of the color and depth attachment; the depth attachment is always cleared to the far plane
+        const LLGL::ClearValue clearValues[2] = { passes[batch.passes.front()].clearColor, LLGL::ClearValue{} };
+        const std::uint32_t numClearValues = (hasDepthStencil ? 2 : 1);
+
+        LLGL::RenderTarget* renderTarget = target.swapChain;
+        std::uint32_t samples = 1;
+        if (target.swapChain != nullptr)
+            samples = target.swapChain->GetSamples();
+        else
+            renderTarget = physicalTargets[target.physicalIndex].renderTarget;
+
+        LLGL::RenderPass* renderPass = GetRenderPass(
+            target.desc.colorFormat, target.desc.depthStencilFormat, samples, batch.loadOp, batch.colorStore, batch.depthStore
+        );
+
+        cmdBuffer.BeginRenderPass(*renderTarget, renderPass, numClearValues, clearValues);
+        {
+            cmdBuffer.SetViewport(target.desc.resolution);
+
+            for (PassID passID : batch.passes)
+            {
+                const Pass& pass = passes[passID];
+
+                bool hasAllReads = true;
+                for (ResourceID read : pass.reads)
+                    hasAllReads = hasAllReads && (resources[read].physicalIndex != invalidID);
+                if (!hasAllReads)
+                    continue;
+
+                cmdBuffer.PushDebugGroup(pass.name);
+                {
+                    pass.execute(cmdBuffer, *this);
+                }
+                cmdBuffer.PopDebugGroup();
+            }
+        }
+        cmdBuffer.EndRenderPass();
+    }
+}
+
+void RenderGraph::ReleaseTargets()
+{
+    for (PhysicalTarget& target : physicalTargets)
+        ReleasePhysicalTarget(target);
+    physicalTargets.clear();
+}
+
+LLGL::Texture* RenderGraph::GetTexture(ResourceID target) const
+{
+    const std::uint32_t physicalIndex = resources[target].physicalIndex;
+    return (physicalIndex != invalidID ? physicalTargets[physicalIndex].colorTexture : nullptr);
+}
+
+LLGL::ResourceHeap* RenderGraph::GetSampleHeap(ResourceID target) const
+{
+    const std::uint32_t physicalIndex = resources[target].physicalIndex;
+    return (physicalIndex != invalidID ? physicalTargets[physicalIndex].sampleHeap : nullptr);
+}
+
+const LLGL::Extent2D& RenderGraph::GetResolution(ResourceID target) const
+{
+    return resources[target].desc.resolution;
+}
+
+void RenderGraph::CullPasses()
+{
+    // Walk backwards from the swap chains: a pass is needed if a later pass reads its target before it is overwritten
+    std::vector<bool> isContentNeeded(resources.size(), false);
+    for (std::size_t i = 0; i < resources.size(); ++i)
+        isContentNeeded[i] = (resources[i].swapChain != nullptr);
+
+    for (std::size_t i = passes.size(); i-- > 0;)
+    {
+        Pass& pass = passes[i];
+        pass.isCulled = (pass.target == invalidID || !isContentNeeded[pass.target]);
+        if (pass.isCulled)
+            continue;
+
+        // Contents written before this pass are only needed if it keeps them
+        if (pass.action != LoadAction::Preserve)
+            isContentNeeded[pass.target] = false;
+
+        for (ResourceID read : pass.reads)
+            isContentNeeded[read] = true;
+    }
+}
+
+void RenderGraph::BuildBatches()
+{
+    std::vector<bool> isWritten(resources.size(), false);
+
+    for (PassID passID = 0; passID < passes.size(); ++passID)
+    {
+        const Pass& pass = passes[passID];
+        if (pass.isCulled)
+            continue;
+
+        // A pass that keeps the contents of the previous pass into the same target continues its render pass
+        const bool continuesBatch = (!batches.empty() && batches.back().target == pass.target && pass.action == LoadAction::Preserve);
+        if (!continuesBatch)
+        {
+            Batch batch;
+            batch.target = pass.target;
+            switch (pass.action)
+            {
+                case LoadAction::Preserve:
+                    // Contents from before this frame are never kept, so there is nothing to load for the first writer
+                    batch.loadOp = (isWritten[pass.target] ? LLGL::AttachmentLoadOp::Load : LLGL::AttachmentLoadOp::Undefined);
+                    break;
+                case LoadAction::Clear:
+                    batch.loadOp = LLGL::AttachmentLoadOp::Clear;
+                    break;
+                case LoadAction::Overwrite:
+                    batch.loadOp = LLGL::AttachmentLoadOp::Undefined;
+                    break;
+            }
+            batches.push_back(std::move(batch));
+        }
+
+        const std::uint32_t batchIndex = static_cast<std::uint32_t>(batches.size() - 1);
+        batches.back().passes.push_back(passID);
+        isWritten[pass.target] = true;
+
+        // Lifetimes of the targets in batches, for aliasing
+        Resource& target = resources[pass.target];
+        target.firstBatch   = std::min(target.firstBatch, batchIndex);
+        target.lastBatch    = std::max(target.lastBatch, batchIndex);
+
+        for (ResourceID read : pass.reads)
+        {
+            Resource& source = resources[read];
+            source.firstBatch   = std::min(source.firstBatch, batchIndex);
+            source.lastBatch    = std::max(source.lastBatch, batchIndex);
+        }
+    }
+
+    // Store the contents of a batch only if the next batch that uses its target reads or keeps them
+    for (std::size_t i = 0; i < batches.size(); ++i)
+    {
+        Batch& batch = batches[i];
+        const bool isSwapChain = (resources[batch.target].swapChain != nullptr);
+        batch.colorStore = (isSwapChain ? LLGL::AttachmentStoreOp::Store : LLGL::AttachmentStoreOp::Undefined);
+        batch.depthStore = LLGL::AttachmentStoreOp::Undefined;
+
+        for (std::size_t j = i + 1; j < batches.size(); ++j)
+        {
+            const Batch& nextBatch = batches[j];
+
+            bool isRead = false;
+            for (PassID passID : nextBatch.passes)
+            {
+                const std::vector<ResourceID>& reads = passes[passID].reads;
+                isRead = isRead || (std::find(reads.begin(), reads.end(), batch.target) != reads.end());
+            }
+
+            if (isRead)
+            {
+                batch.colorStore = LLGL::AttachmentStoreOp::Store;
+                break;
+            }
+
+            if (nextBatch.target == batch.target)
+            {
+                if (nextBatch.loadOp == LLGL::AttachmentLoadOp::Load)
+                {
+                    batch.colorStore = LLGL::AttachmentStoreOp::Store;
+                    batch.depthStore = LLGL::AttachmentStoreOp::Store;
+                }
+                break;
+            }
+        }
+    }
+}
+
+void RenderGraph::AssignPhysicalTargets()
+{
+    // Visit the transient targets in the order of their first use, so each can take over a texture whose last use has passed
+    std::vector<ResourceID> transientTargets;
+    for (ResourceID resourceID = 0; resourceID < resources.size(); ++resourceID)
+    {
+        const Resource& resource = resources[resourceID];
+        if (resource.swapChain == nullptr && resource.firstBatch != invalidID)
+            transientTargets.push_back(resourceID);
+    }
+
+    std::stable_sort(
+        transientTargets.begin(), transientTargets.end(),
+        [this](ResourceID lhs, ResourceID rhs) -> bool
+        {
+            return (resources[lhs].firstBatch < resources[rhs].firstBatch);
+        }
+    );
+
+    for (ResourceID resourceID : transientTargets)
+    {
+        Resource& resource = resources[resourceID];
+
+        std::uint32_t physicalIndex = invalidID;
+        for (std::uint32_t i = 0; i < physicalTargets.size() && physicalIndex == invalidID; ++i)
+        {
+            const PhysicalTarget& candidate = physicalTargets[i];
+            const bool isBusy = (candidate.lastFrame == frame && candidate.busyUntilBatch >= resource.firstBatch);
+            if (!isBusy && IsTargetDescEqual(candidate.desc, resource.desc))
+                physicalIndex = i;
+        }
+
+        // Creating a texture here could race with the main thread, so the target stays without texture
+        if (physicalIndex == invalidID)
+        {
+            if (!hasReportedMiss)
+            {
+                LLGL::Log::Errorf(
+                    LLGL::Log::ColorFlags::StdError,
+                    "No reserved texture for render graph target '%s' (%u x %u)\n",
+                    resource.desc.debugName, resource.desc.resolution.width, resource.desc.resolution.height
+                );
+                hasReportedMiss = true;
+            }
+            continue;
+        }
+
+        PhysicalTarget& target = physicalTargets[physicalIndex];
+        target.lastFrame        = frame;
+        target.busyUntilBatch   = resource.lastBatch;
+        resource.physicalIndex  = physicalIndex;
+    }
+}
+
+RenderGraph::PhysicalTarget RenderGraph::CreatePhysicalTarget(const TargetDesc& desc)
+{
+    PhysicalTarget target;
+    target.desc = desc;
+
+    LLGL::TextureDescriptor colorTextureDesc;
+    {
+        colorTextureDesc.debugName  = desc.debugName;
+        colorTextureDesc.type       = LLGL::TextureType::Texture2D;
+        colorTextureDesc.bindFlags  = LLGL::BindFlags::ColorAttachment | LLGL::BindFlags::Sampled;
+        colorTextureDesc.miscFlags  = LLGL::MiscFlags::NoInitialData;
+        colorTextureDesc.format     = desc.colorFormat;
+        colorTextureDesc.extent     = LLGL::Extent3D{ desc.resolution.width, desc.resolution.height, 1 };
+        colorTextureDesc.mipLevels  = 1;
+    }
+    target.colorTexture = renderer->CreateTexture(colorTextureDesc);
+
+    const std::uint64_t bitsPerPixel = LLGL::GetFormatAttribs(desc.colorFormat).bitSize + LLGL::GetFormatAttribs(desc.depthStencilFormat).bitSize;
+    const std::uint64_t targetSize = static_cast<std::uint64_t>(desc.resolution.width) * desc.resolution.height * bitsPerPixel / 8;
+    MemoryTracker::Get().TrackResource(target.colorTexture, MemoryCategory::Texture, targetSize, desc.debugName, windowIndex);
+
+    LLGL::RenderTargetDescriptor renderTargetDesc;
+    {
+        renderTargetDesc.debugName              = desc.debugName;
+        renderTargetDesc.renderPass             = GetRenderPass(
+            desc.colorFormat, desc.depthStencilFormat, 1,
+            LLGL::AttachmentLoadOp::Clear, LLGL::AttachmentStoreOp::Store, LLGL::AttachmentStoreOp::Undefined
+        );
+        renderTargetDesc.resolution             = desc.resolution;
+        renderTargetDesc.colorAttachments[0]    = LLGL::AttachmentDescriptor{ target.colorTexture };
+        if (desc.depthStencilFormat != LLGL::Format::Undefined)
+            renderTargetDesc.depthStencilAttachment = LLGL::AttachmentDescriptor{ desc.depthStencilFormat };
+    }
+    target.renderTarget = renderer->CreateRenderTarget(renderTargetDesc);
+
+    if (sampleLayout != nullptr)
+    {
+        const LLGL::ResourceViewDescriptor resourceViews[2] =
+        {
+            LLGL::ResourceViewDescriptor{ target.colorTexture },
+            LLGL::ResourceViewDescriptor{ sampler },
+        };
+
+        LLGL::ResourceHeapDescriptor sampleHeapDesc;
+        {
+            sampleHeapDesc.debugName        = desc.debugName;
+            sampleHeapDesc.pipelineLayout   = sampleLayout;
+            sampleHeapDesc.numResourceViews = 2;
+        }
+        target.sampleHeap = renderer->CreateResourceHeap(sampleHeapDesc, resourceViews);
+    }
+
+    return target;
+}
+
+void RenderGraph::ReleasePhysicalTarget(PhysicalTarget& target)
+{
+    if (target.sampleHeap != nullptr)
+        renderer->Release(*target.sampleHeap);
+    renderer->Release(*target.renderTarget);
+    MemoryTracker::Get().UntrackResource(target.colorTexture);
+    renderer->Release(*target.colorTexture);
+}
+
+void RenderGraph::CreateRenderPasses(LLGL::Format colorFormat, LLGL::Format depthStencilFormat, std::uint32_t samples)
+{
+    const LLGL::AttachmentLoadOp loadOps[3] = { LLGL::AttachmentLoadOp::Undefined, LLGL::AttachmentLoadOp::Load, LLGL::AttachmentLoadOp::Clear };
+    const LLGL::AttachmentStoreOp storeOps[2] = { LLGL::AttachmentStoreOp::Undefined, LLGL::AttachmentStoreOp::Store };
+
+    for (LLGL::AttachmentLoadOp loadOp : loadOps)
+    {
+        for (LLGL::AttachmentStoreOp colorStore : storeOps)
+        {
+            for (LLGL::AttachmentStoreOp depthStore : storeOps)
+                GetRenderPass(colorFormat, depthStencilFormat, samples, loadOp, colorStore, depthStore);
+        }
+    }
+}
+
+LLGL::RenderPass* RenderGraph::GetRenderPass(
+    LLGL::Format            colorFormat,
+    LLGL::Format            depthStencilFormat,
+    std::uint32_t           samples,
+    LLGL::AttachmentLoadOp  loadOp,
+    LLGL::AttachmentStoreOp colorStore,
+    LLGL::AttachmentStoreOp depthStore)
+{
+    for (const CachedRenderPass& entry : renderPasses)
+    {
+        if (entry.colorFormat        == colorFormat        &&
+            entry.depthStencilFormat == depthStencilFormat &&
+            entry.samples            == samples            &&
+            entry.loadOp             == loadOp             &&
+            entry.colorStore         == colorStore         &&
+            entry.depthStore         == depthStore)
+        {
+            return entry.renderPass;
+        }
+    }
+
+    LLGL::RenderPassDescriptor renderPassDesc;
+    {
+        renderPassDesc.debugName                    = "RenderGraph.RenderPass";
+        renderPassDesc.colorAttachments[0].format   = colorFormat;
+        renderPassDesc.colorAttachments[0].loadOp   = loadOp;
+        renderPassDesc.colorAttachments[0].storeOp  = colorStore;
+        renderPassDesc.depthAttachment.format       = depthStencilFormat;
+        renderPassDesc.depthAttachment.loadOp       = loadOp;
+        renderPassDesc.depthAttachment.storeOp      = depthStore;
+        renderPassDesc.stencilAttachment.format     = depthStencilFormat;
+        renderPassDesc.stencilAttachment.loadOp     = LLGL::AttachmentLoadOp::Undefined;   // No pass uses stencil
+        renderPassDesc.stencilAttachment.storeOp    = LLGL::AttachmentStoreOp::Undefined;
+        renderPassDesc.samples                      = samples;
+    }
+    LLGL::RenderPass* renderPass = renderer->CreateRenderPass(renderPassDesc);
+
+    CachedRenderPass entry;
+    {
+        entry.colorFormat           = colorFormat;
+        entry.depthStencilFormat    = depthStencilFormat;
+        entry.samples               = samples;
+        entry.loadOp                = loadOp;
+        entry.colorStore            = colorStore;
+        entry.depthStore            = depthStore;
+        entry.renderPass            = renderPass;
+    }
+    renderPasses.push_back(entry);
+
+    return renderPass;
+}
+
+bool RenderGraph::IsTargetDescEqual(const TargetDesc& lhs, const TargetDesc& rhs)
+{
+    return
+    (
+        lhs.resolution.width    == rhs.resolution.width     &&
+        lhs.resolution.height   == rhs.resolution.height    &&
+        lhs.colorFormat         == rhs.colorFormat          &&
+        lhs.depthStencilFormat  == rhs.depthStencilFormat
+    );
+}
+
@@ -0,0 +1,197 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * RenderGraph.h
+ */
+
+#pragma once
+
+#include <LLGL/LLGL.h>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+
+// Per-frame graph of render passes that declare the target they write and the textures they read.
+// Each frame is built anew with Begin(), AddPass(), Write(), and Read(); Execute() then compiles and records it:
+//  - Passes whose target is never read and never presented are culled.
+//  - Consecutive passes into the same target share one LLGL render pass, and load/store ops are derived
+//    from the passes before and after, so nothing is cleared or stored that no pass needs.
+//  - Transient targets are backed by pooled textures, which are reserved up front with ReserveTarget(), so Execute()
+//    never creates resources and can run on the render thread. Targets with disjoint lifetimes and the same description
+//    share one texture within a frame, and the pool is reused across frames.
+// Resource transitions between passes are left to LLGL, which tracks the state of all textures it binds.
+class RenderGraph
+{
+public:
+    using ResourceID    = std::uint32_t;
+    using PassID        = std::uint32_t;
+
+    static constexpr std::uint32_t invalidID = ~0u;
+
+    // How a pass treats the contents of its target that were written before.
+    enum class LoadAction
+    {
+        Preserve,   // Keeps the contents of earlier passes in this frame
+        Clear,      // Clears color and depth
+        Overwrite,  // Writes every pixel itself, e.g. with a fullscreen draw; color and depth start undefined
+    };
+
+    struct TargetDesc
+    {
+        const char*     debugName           = "RenderGraph.Target";
+        LLGL::Extent2D  resolution;
+        LLGL::Format    colorFormat         = LLGL::Format::RGBA8UNorm;
+        LLGL::Format    depthStencilFormat  = LLGL::Format::Undefined;
+    };
+
+    // Records a pass; the render pass of its target has begun and the viewport covers the whole target.
+    using ExecuteFunc = std::function<void(LLGL::CommandBuffer& cmdBuffer, const RenderGraph& graph)>;
+
+public:
+    // Transient targets are tracked in the memory of the specified window. If 'sampleLayout' is specified,
+    // each transient target has a resource heap with its color texture and 'sampler' to be read by a pass.
+    RenderGraph(int windowIndex, LLGL::PipelineLayout* sampleLayout, LLGL::Sampler* sampler);
+    ~RenderGraph();
+
+    RenderGraph(const RenderGraph&) = delete;
+    RenderGraph& operator = (const RenderGraph&) = delete;
+
+    // Makes sure the pool holds at least 'count' textures for transient targets with the specified description, and creates
+    // the render passes they are recorded with. Reserved textures are kept until ReleaseTargets(). The graph must not be in flight.
+    void ReserveTarget(const TargetDesc& desc, std::uint32_t count = 1);
+
+    // Creates the render passes the swap chain is recorded with. The graph must not be in flight.
+    void ReserveSwapChain(const LLGL::SwapChain& swapChain);
+
+    // Discards all passes and resources of the previous frame.
+    void Begin();
+
+    // Adds the swap chain as resource. Its contents are always stored, so passes that write it are never culled.
+    ResourceID ImportSwapChain(LLGL::SwapChain& swapChain);
+
+    // Adds a transient target whose contents only live within this frame.
+    ResourceID CreateTarget(const TargetDesc& desc);
+
+    PassID AddPass(const char* name, const ExecuteFunc& execute);
+
+    // Declares the single target a pass renders into.
+    void Write(PassID pass, ResourceID target, LoadAction action, const LLGL::ClearValue& clearColor = LLGL::ClearValue{});
+
+    // Declares that a pass samples the color texture of a target that an earlier pass has written.
+    void Read(PassID pass, ResourceID target);
+
+    // Culls passes, assigns reserved textures to the transient targets, and records all remaining passes.
+    // Passes into or from a target without a free reserved texture are skipped.
+    void Execute(LLGL::CommandBuffer& cmdBuffer);
+
+    // Releases all pooled textures, e.g. after a resize made them obsolete. The graph must not be in flight.
+    void ReleaseTargets();
+
+    // Accessors for the passes while they are recorded.
+    LLGL::Texture* GetTexture(ResourceID target) const;
+    LLGL::ResourceHeap* GetSampleHeap(ResourceID target) const;
+    const LLGL::Extent2D& GetResolution(ResourceID target) const;
+
+    // Returns the number of LLGL render passes the last Execute() has recorded.
+    std::uint32_t GetNumRenderPasses() const
+    {
+        return static_cast<std::uint32_t>(batches.size());
+    }
+
+private:
+    struct Resource
+    {
+        TargetDesc          desc;
+        LLGL::SwapChain*    swapChain       = nullptr;      // Non-null for imported swap chains
+        std::uint32_t       physicalIndex   = invalidID;    // Index into 'physicalTargets' of transient targets
+        std::uint32_t       firstBatch      = invalidID;    // First and last batch that writes or reads the target
+        std::uint32_t       lastBatch       = 0;
+    };
+
+    struct Pass
+    {
+        const char*             name        = nullptr;
+        ExecuteFunc             execute;
+        ResourceID              target      = invalidID;
+        LoadAction              action      = LoadAction::Preserve;
+        LLGL::ClearValue        clearColor;
+        std::vector<ResourceID> reads;
+        bool                    isCulled    = false;
+    };
+
+    // Consecutive passes that render into the same target within one LLGL render pass.
+    struct Batch
+    {
+        ResourceID              target      = invalidID;
+        std::vector<PassID>     passes;
+        LLGL::AttachmentLoadOp  loadOp      = LLGL::AttachmentLoadOp::Undefined;
+        LLGL::AttachmentStoreOp colorStore  = LLGL::AttachmentStoreOp::Undefined;
+        LLGL::AttachmentStoreOp depthStore  = LLGL::AttachmentStoreOp::Undefined;
+    };
+
+    struct PhysicalTarget
+    {
+        TargetDesc              desc;
+        LLGL::Texture*          colorTexture    = nullptr;
+        LLGL::RenderTarget*     renderTarget    = nullptr;
+        LLGL::ResourceHeap*     sampleHeap      = nullptr;
+        std::uint64_t           lastFrame       = 0;    // Last frame a transient target was assigned to it
+        std::uint32_t           busyUntilBatch  = 0;    // Last batch of the latest target assigned in 'lastFrame'
+    };
+
+    struct CachedRenderPass
+    {
+        LLGL::Format            colorFormat;
+        LLGL::Format            depthStencilFormat;
+        std::uint32_t           samples;
+        LLGL::AttachmentLoadOp  loadOp;
+        LLGL::AttachmentStoreOp colorStore;
+        LLGL::AttachmentStoreOp depthStore;
+        LLGL::RenderPass*       renderPass;
+    };
+
+private:
+    // Marks passes whose results are never used as culled.
+    void CullPasses();
+
+    // Groups the remaining passes into batches and derives their load and store ops.
+    void BuildBatches();
+
+    // Assigns a pooled texture to each transient target that is used.
+    void AssignPhysicalTargets();
+
+    PhysicalTarget CreatePhysicalTarget(const TargetDesc& desc);
+    void ReleasePhysicalTarget(PhysicalTarget& target);
+
+    // Creates the render passes for all load and store ops a batch may be recorded with.
+    void CreateRenderPasses(LLGL::Format colorFormat, LLGL::Format depthStencilFormat, std::uint32_t samples);
+
+    LLGL::RenderPass* GetRenderPass(
+        LLGL::Format            colorFormat,
+        LLGL::Format            depthStencilFormat,
+        std::uint32_t           samples,
+        LLGL::AttachmentLoadOp  loadOp,
+        LLGL::AttachmentStoreOp colorStore,
+        LLGL::AttachmentStoreOp depthStore
+    );
+
+    static bool IsTargetDescEqual(const TargetDesc& lhs, const TargetDesc& rhs);
+
+private:
+    int                             windowIndex     = 0;
+    LLGL::PipelineLayout*           sampleLayout    = nullptr;
+    LLGL::Sampler*                  sampler         = nullptr;
+
+    std::vector<Resource>           resources;
+    std::vector<Pass>               passes;
+    std::vector<Batch>              batches;
+
+    std::vector<PhysicalTarget>     physicalTargets;        // Pool of reserved transient textures across frames
+    std::vector<CachedRenderPass>   renderPasses;
+    std::uint64_t                   frame           = 0;
+    bool                            hasReportedMiss = false;    // Only the first target without a reserved texture is reported
+};
+
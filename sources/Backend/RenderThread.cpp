@@ -0,0 +1,98 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * RenderThread.cpp
+ */
+
+#include "RenderThread.h"
+#include <LLGL/LLGL.h>
+
+
+RenderThread::~RenderThread()
+{
+    Stop();
+}
+
+void RenderThread::Start()
+{
+    if (IsRunning())
+        return;
+
+    isQuit = false;
+    thread = std::thread(&RenderThread::Run, this);
+}
+
+void RenderThread::Stop()
+{
+    if (!IsRunning())
+        return;
+
+    {
+        std::unique_lock<std::mutex> lock{ mutex };
+        WaitIdleLocked(lock);
+        isQuit = true;
+    }
+    frameCondition.notify_one();
+
+    thread.join();
+}
+
+void RenderThread::Submit(FrameFunc frameFunc)
+{
+    if (!IsRunning())
+    {
+        frameFunc();
+        return;
+    }
+
+    const std::uint64_t startTick = LLGL::Timer::Tick();
+    {
+        std::unique_lock<std::mutex> lock{ mutex };
+        WaitIdleLocked(lock);
+        pendingFrame = std::move(frameFunc);
+    }
+    frameCondition.notify_one();
+
+    waitTime = static_cast<float>(static_cast<double>(LLGL::Timer::Tick() - startTick) / static_cast<double>(LLGL::Timer::Frequency()));
+}
+
+void RenderThread::WaitIdle()
+{
+    if (!IsRunning())
+        return;
+
+    std::unique_lock<std::mutex> lock{ mutex };
+    WaitIdleLocked(lock);
+}
+
+void RenderThread::Run()
+{
+    for (;;)
+    {
+        FrameFunc frameFunc;
+        {
+            std::unique_lock<std::mutex> lock{ mutex };
+            frameCondition.wait(lock, [this]() { return (isQuit || pendingFrame); });
+            if (isQuit)
+                return;
+            frameFunc = pendingFrame;
+        }
+
+        frameFunc();
+
+        // The frame only counts as finished after it has been executed, so WaitIdle() covers the whole frame
+        {
+            std::lock_guard<std::mutex> lock{ mutex };
+            pendingFrame = nullptr;
+        }
+        idleCondition.notify_all();
+    }
+}
+
+void RenderThread::WaitIdleLocked(std::unique_lock<std::mutex>& lock)
+{
+    idleCondition.wait(lock, [this]() { return !pendingFrame; });
+}
+
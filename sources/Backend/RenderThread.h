@@ -0,0 +1,66 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * RenderThread.h
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+
+// Runs frames on a dedicated thread, one at a time. The main thread submits the next frame while the
+// previous one is still being recorded and presented, so at most one frame is in flight at any time.
+class RenderThread
+{
+public:
+    using FrameFunc = std::function<void()>;
+
+public:
+    ~RenderThread();
+
+    void Start();
+
+    // Waits for the frame in flight and joins the thread.
+    void Stop();
+
+    // Waits until the previous frame has finished, then hands the new frame over to the render thread.
+    // Runs the frame on the calling thread if the render thread is not running.
+    void Submit(FrameFunc frameFunc);
+
+    // Waits until the frame in flight has finished, e.g. before resources it uses are replaced.
+    void WaitIdle();
+
+    bool IsRunning() const
+    {
+        return thread.joinable();
+    }
+
+    // Returns the time in seconds the last call of Submit() waited for the previous frame.
+    float GetWaitTime() const
+    {
+        return waitTime;
+    }
+
+private:
+    void Run();
+
+    // Waits with a locked mutex until no frame is in flight.
+    void WaitIdleLocked(std::unique_lock<std::mutex>& lock);
+
+private:
+    std::thread             thread;
+    std::mutex              mutex;
+    std::condition_variable frameCondition;     // Signaled when a frame is submitted or the thread is stopped
+    std::condition_variable idleCondition;      // Signaled when the frame in flight has finished
+    FrameFunc               pendingFrame;       // Frame in flight; empty while the render thread is idle
+    bool                    isQuit      = false;
+
+    float                   waitTime    = 0.0f;
+};
+
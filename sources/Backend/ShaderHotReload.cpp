@@ -0,0 +1,173 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * ShaderHotReload.cpp
+ */
+
+#include "ShaderHotReload.h"
+#include "../Platform/Platform.h"
+#include <fstream>
+#include <iterator>
+
+
+// Editors write a file in several steps (truncate, write, rename), so a reload only starts once the directory was quiet
+// for this many seconds.
+static constexpr float g_reloadDebounceTime = 0.1f;
+
+static float TicksToSeconds(std::uint64_t ticks)
+{
+    return static_cast<float>(static_cast<double>(ticks) / static_cast<double>(LLGL::Timer::Frequency()));
+}
+
+ShaderHotReload::~ShaderHotReload()
+{
+    Unwatch();
+}
+
+bool ShaderHotReload::Watch(const std::string& directory, const std::vector<std::string>& filenames, const CreateFunc& createFunc)
+{
+    Unwatch();
+
+    if (!PlatformWatchDirectory(directory.c_str()))
+    {
+        LLGL::Log::Errorf(LLGL::Log::ColorFlags::StdError, "Failed to watch shader directory: %s\n", directory.c_str());
+        return false;
+    }
+
+    this->directory     = directory;
+    this->filenames     = filenames;
+    this->createFunc    = createFunc;
+    this->isWatching    = true;
+
+    return true;
+}
+
+void ShaderHotReload::Unwatch()
+{
+    if (!isWatching)
+        return;
+
+    // Sources that are still being loaded are no longer needed
+    if (thread.joinable())
+        thread.join();
+    loadedSources.clear();
+    loadedSizes.clear();
+    loadErrors.clear();
+
+    PlatformUnwatchDirectory();
+
+    isWatching      = false;
+    isReloadQueued  = false;
+}
+
+LLGL::PipelineState* ShaderHotReload::Poll()
+{
+    if (!isWatching)
+        return nullptr;
+
+    const std::uint64_t tick = LLGL::Timer::Tick();
+    if (PlatformPollDirectoryChanges())
+    {
+        isReloadQueued = true;
+        lastChangeTick = tick;
+    }
+
+    // Create the PSO once the sources are loaded; a reload that was queued meanwhile starts with the next call
+    if (thread.joinable())
+    {
+        if (!isThreadDone.load(std::memory_order_acquire))
+            return nullptr;
+        thread.join();
+
+        // Don't compile a partially written file; load it again once the directory is quiet
+        if (AreSourcesUnstable())
+        {
+            loadedSources.clear();
+            loadedSizes.clear();
+            loadErrors.clear();
+            isReloadQueued = true;
+            lastChangeTick = tick;
+            return nullptr;
+        }
+
+        return FinishReload();
+    }
+
+    if (isReloadQueued && TicksToSeconds(tick - lastChangeTick) >= g_reloadDebounceTime)
+    {
+        isReloadQueued = false;
+        isThreadDone.store(false, std::memory_order_relaxed);
+        thread = std::thread(&ShaderHotReload::LoadSources, this);
+    }
+
+    return nullptr;
+}
+
+void ShaderHotReload::LoadSources()
+{
+    const std::uint64_t startTick = LLGL::Timer::Tick();
+
+    // Read in binary mode, so SPIR-V modules are not altered and text keeps its line endings
+    loadedSources.resize(filenames.size());
+    loadedSizes.resize(filenames.size());
+    for (std::size_t i = 0; i < filenames.size(); ++i)
+    {
+        const std::string path = directory + filenames[i];
+        std::ifstream file{ path, std::ios::binary };
+        if (!file.good())
+        {
+            loadErrors += "Failed to read shader file: " + path + "\n";
+            continue;
+        }
+        loadedSources[i].assign(std::istreambuf_iterator<char>{ file }, std::istreambuf_iterator<char>{});
+
+        // Query the size again after reading, to detect whether the editor was still writing the file
+        std::ifstream sizeFile{ path, std::ios::binary | std::ios::ate };
+        loadedSizes[i] = (sizeFile.good() ? static_cast<std::uint64_t>(sizeFile.tellg()) : 0);
+    }
+
+    loadTime = TicksToSeconds(LLGL::Timer::Tick() - startTick);
+
+    isThreadDone.store(true, std::memory_order_release);
+}
+
+bool ShaderHotReload::AreSourcesUnstable() const
+{
+    // Sources that failed to load are reported as errors instead
+    if (!loadErrors.empty())
+        return false;
+
+    for (std::size_t i = 0; i < loadedSources.size(); ++i)
+    {
+        if (loadedSources[i].size() != loadedSizes[i])
+            return true;
+    }
+
+    return false;
+}
+
+LLGL::PipelineState* ShaderHotReload::FinishReload()
+{
+    const std::uint64_t startTick = LLGL::Timer::Tick();
+
+    errors = std::move(loadErrors);
+    loadErrors.clear();
+
+    LLGL::PipelineState* pso = nullptr;
+    if (errors.empty())
+        pso = createFunc(loadedSources, errors);
+    loadedSources.clear();
+    loadedSizes.clear();
+
+    compileTime = TicksToSeconds(LLGL::Timer::Tick() - startTick);
+
+    if (pso != nullptr)
+        ++numReloads;
+    else
+        LLGL::Log::Errorf(LLGL::Log::ColorFlags::StdError, "Shader reload failed:\n%s", errors.c_str());
+
+    return pso;
+}
+
@@ -0,0 +1,106 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * ShaderHotReload.h
+ */
+
+#pragma once
+
+#include <LLGL/LLGL.h>
+#include <functional>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <cstdint>
+
+
+// Rebuilds a PSO whenever a file in the watched shader directory changes. The shader files are read on a background
+// thread, so the frame loop never waits for the file system. The render system is not thread-safe and LLGL has no
+// deferred context, so the shaders and the PSO are created from the loaded sources on the main thread within Poll().
+// That main-thread stall is unavoidable; it is measured separately from the load time and shown in the GUI.
+class ShaderHotReload
+{
+public:
+    // Creates the PSO from the shader sources, which are in the same order as the watched filenames.
+    // Returns null and appends the error text on failure.
+    using CreateFunc = std::function<LLGL::PipelineState*(const std::vector<std::string>& sources, std::string& errors)>;
+
+public:
+    ~ShaderHotReload();
+
+    // Starts watching the directory for changes of the specified shader files.
+    bool Watch(const std::string& directory, const std::vector<std::string>& filenames, const CreateFunc& createFunc);
+
+    // Waits for pending file reads and stops watching.
+    void Unwatch();
+
+    // Must be called between frames on the main thread. Returns the new PSO once a reload succeeded; the caller replaces
+    // and releases the previous PSO. Returns null while loading, if nothing changed, or if the reload failed.
+    LLGL::PipelineState* Poll();
+
+    bool IsWatching() const
+    {
+        return isWatching;
+    }
+
+    bool IsCompiling() const
+    {
+        return thread.joinable();
+    }
+
+    // Returns the error text of the last reload, or an empty string if it succeeded.
+    const std::string& GetErrors() const
+    {
+        return errors;
+    }
+
+    // Returns the time in seconds the last reload took to read the shader files on the background thread.
+    float GetLoadTime() const
+    {
+        return loadTime;
+    }
+
+    // Returns the time in seconds the last reload stalled the main thread to compile the shaders and create the PSO.
+    float GetCompileTime() const
+    {
+        return compileTime;
+    }
+
+    std::uint32_t GetNumReloads() const
+    {
+        return numReloads;
+    }
+
+private:
+    // Reads all shader files into 'loadedSources'; called on the background thread.
+    void LoadSources();
+
+    // Returns true if a file was still being written while it was read.
+    bool AreSourcesUnstable() const;
+
+    // Creates the PSO from the loaded sources on the calling thread.
+    LLGL::PipelineState* FinishReload();
+
+private:
+    std::string                 directory;
+    std::vector<std::string>    filenames;
+    CreateFunc                  createFunc;
+    bool                        isWatching      = false;
+    bool                        isReloadQueued  = false;    // Files changed since the last reload was started
+    std::uint64_t               lastChangeTick  = 0;        // Tick of the last directory change, for debouncing
+
+    std::thread                 thread;
+    std::atomic<bool>           isThreadDone    { false };
+    std::vector<std::string>    loadedSources;              // Written by the load thread until 'isThreadDone' is set
+    std::string                 loadErrors;                 // Written by the load thread until 'isThreadDone' is set
+    std::vector<std::uint64_t>  loadedSizes;                // File sizes after reading; written by the load thread until 'isThreadDone' is set
+    float                       loadTime        = 0.0f;     // Written by the load thread until 'isThreadDone' is set
+
+    std::string                 errors;
+    float                       compileTime     = 0.0f;
+    std::uint32_t               numReloads      = 0;
+};
+
@@ -0,0 +1,195 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * SwapChainPool.cpp
+ */
+
+#include "SwapChainPool.h"
+#include "../Globals.h"
+#include "../MemoryTracker.h"
+
+
+// Released swap chains beyond this number are destroyed, least recently released first
+static constexpr std::size_t g_maxPooledSwapChains = 8;
+
+static std::uint32_t CeilLog2(std::uint32_t value)
+{
+    std::uint32_t exponent = 0;
+    while (exponent < 31 && (1u << exponent) < value)
+        ++exponent;
+    return exponent;
+}
+
+static bool IsExtentEqual(const LLGL::Extent2D& lhs, const LLGL::Extent2D& rhs)
+{
+    return (lhs.width == rhs.width && lhs.height == rhs.height);
+}
+
+SwapChainPool::~SwapChainPool()
+{
+    for (Entry& entry : entries)
+        Destroy(entry);
+}
+
+LLGL::SwapChain* SwapChainPool::Acquire(const LLGL::SwapChainDescriptor& desc, bool isDecorated)
+{
+    // Prefer a pooled swap chain of the same resolution, then one of the same size class, then any other of the same format.
+    // Even resizing one is much faster than creating a new window and swap chain.
+    const std::uint32_t sizeClass = GetSizeClass(desc.resolution);
+
+    Entry* bestEntry = nullptr;
+    int bestScore = 0;
+
+    for (Entry& entry : entries)
+    {
+        const bool isSameFormat =
+        (
+            entry.colorBits     == desc.colorBits   &&
+            entry.depthBits     == desc.depthBits   &&
+            entry.stencilBits   == desc.stencilBits &&
+            entry.samples       == desc.samples     &&
+            entry.isDecorated   == isDecorated
+        );
+        if (entry.isAcquired || !isSameFormat)
+            continue;
+
+        const LLGL::Extent2D resolution = entry.swapChain->GetResolution();
+        int score = 1;
+        if (IsExtentEqual(resolution, desc.resolution))
+            score = 3;
+        else if (GetSizeClass(resolution) == sizeClass)
+            score = 2;
+
+        if (score > bestScore)
+        {
+            bestEntry = &entry;
+            bestScore = score;
+        }
+    }
+
+    if (bestEntry != nullptr)
+    {
+        if (bestScore < 3)
+        {
+            bestEntry->window->SetSize(desc.resolution);
+            bestEntry->swapChain->ResizeBuffers(desc.resolution);
+            MemoryTracker::Get().TrackResource(bestEntry->swapChain, MemoryCategory::SwapChain, GetMemorySize(*bestEntry->swapChain), "Viewport.SwapChain");
+            ++numResized;
+        }
+        bestEntry->isAcquired = true;
+        ++numReused;
+        return bestEntry->swapChain;
+    }
+
+    // Create a new window first, so it starts hidden and without decoration if requested
+    LLGL::WindowDescriptor windowDesc;
+    {
+        windowDesc.size     = desc.resolution;
+        windowDesc.flags    = (isDecorated ? LLGL::WindowFlags::Resizable : LLGL::WindowFlags::Borderless);
+    }
+
+    Entry entry;
+    {
+        entry.window        = LLGL::Window::Create(windowDesc);
+        entry.swapChain     = renderer->CreateSwapChain(desc, entry.window);
+        entry.colorBits     = desc.colorBits;
+        entry.depthBits     = desc.depthBits;
+        entry.stencilBits   = desc.stencilBits;
+        entry.samples       = desc.samples;
+        entry.isDecorated   = isDecorated;
+        entry.isAcquired    = true;
+    }
+    MemoryTracker::Get().TrackResource(entry.swapChain, MemoryCategory::SwapChain, GetMemorySize(*entry.swapChain), "Viewport.SwapChain");
+
+    entries.push_back(entry);
+    ++numCreated;
+
+    return entry.swapChain;
+}
+
+void SwapChainPool::Release(LLGL::SwapChain& swapChain)
+{
+    std::size_t numPooled = 0;
+    for (Entry& entry : entries)
+    {
+        if (entry.swapChain == &swapChain)
+        {
+            entry.window->Show(false);
+            entry.isAcquired    = false;
+            entry.releaseIndex  = ++numReleases;
+        }
+        if (!entry.isAcquired)
+            ++numPooled;
+    }
+
+    // Destroy the least recently released swap chain if the pool is full
+    if (numPooled > g_maxPooledSwapChains)
+    {
+        std::size_t oldestIndex = entries.size();
+        for (std::size_t i = 0; i < entries.size(); ++i)
+        {
+            if (!entries[i].isAcquired && (oldestIndex == entries.size() || entries[i].releaseIndex < entries[oldestIndex].releaseIndex))
+                oldestIndex = i;
+        }
+        Destroy(entries[oldestIndex]);
+        entries.erase(entries.begin() + oldestIndex);
+    }
+}
+
+void SwapChainPool::Clear()
+{
+    for (std::size_t i = entries.size(); i-- > 0;)
+    {
+        if (!entries[i].isAcquired)
+        {
+            Destroy(entries[i]);
+            entries.erase(entries.begin() + i);
+        }
+    }
+    numCreated  = 0;
+    numReused   = 0;
+    numResized  = 0;
+}
+
+SwapChainPool::Stats SwapChainPool::GetStats() const
+{
+    Stats stats;
+    {
+        for (const Entry& entry : entries)
+        {
+            if (entry.isAcquired)
+                ++stats.numAcquired;
+            else
+                ++stats.numPooled;
+        }
+        stats.numCreated    = numCreated;
+        stats.numReused     = numReused;
+        stats.numResized    = numResized;
+    }
+    return stats;
+}
+
+std::uint64_t SwapChainPool::GetMemorySize(const LLGL::SwapChain& swapChain)
+{
+    const LLGL::Extent2D resolution = swapChain.GetResolution();
+    const std::uint64_t numPixels = static_cast<std::uint64_t>(resolution.width) * resolution.height * swapChain.GetSamples();
+    const std::uint64_t colorBits = LLGL::GetFormatAttribs(swapChain.GetColorFormat()).bitSize;
+    const std::uint64_t depthBits = LLGL::GetFormatAttribs(swapChain.GetDepthStencilFormat()).bitSize;
+    return numPixels * (colorBits * swapChain.GetNumSwapBuffers() + depthBits) / 8;
+}
+
+std::uint32_t SwapChainPool::GetSizeClass(const LLGL::Extent2D& resolution)
+{
+    return ((CeilLog2(resolution.width) << 8) | CeilLog2(resolution.height));
+}
+
+void SwapChainPool::Destroy(Entry& entry)
+{
+    MemoryTracker::Get().UntrackResource(entry.swapChain);
+    renderer->Release(*entry.swapChain);
+    entry.swapChain = nullptr;
+    entry.window.reset();
+}
+
@@ -0,0 +1,82 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * SwapChainPool.h
+ */
+
+#pragma once
+
+#include <LLGL/LLGL.h>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+
+// Recycles swap chains together with their windows, since creating them takes long enough to cause a visible hitch,
+// e.g. each time ImGui opens a popup in its own platform window. Released swap chains are hidden and kept by their
+// format and size class; Acquire() takes one with the same format and prefers the same size to avoid a resize.
+class SwapChainPool
+{
+public:
+    struct Stats
+    {
+        std::uint32_t   numAcquired = 0;    // Swap chains currently in use
+        std::uint32_t   numPooled   = 0;    // Hidden swap chains waiting for reuse
+        std::uint64_t   numCreated  = 0;    // Swap chains created since the pool was cleared
+        std::uint64_t   numReused   = 0;    // Calls to Acquire() that took a pooled swap chain
+        std::uint64_t   numResized  = 0;    // Pooled swap chains that had to be resized for reuse
+    };
+
+public:
+    SwapChainPool() = default;
+    ~SwapChainPool();
+
+    SwapChainPool(const SwapChainPool&) = delete;
+    SwapChainPool& operator = (const SwapChainPool&) = delete;
+
+    // Returns a swap chain with a hidden window of the resolution and formats in 'desc'. Windows without decoration
+    // are borderless. The window is not moved, so the caller must set its position before it is shown.
+    LLGL::SwapChain* Acquire(const LLGL::SwapChainDescriptor& desc, bool isDecorated);
+
+    // Hides the window of the swap chain and keeps it for reuse. The least recently released swap chains are
+    // destroyed if the pool is full.
+    void Release(LLGL::SwapChain& swapChain);
+
+    // Destroys all swap chains that are not acquired.
+    void Clear();
+
+    Stats GetStats() const;
+
+    // Returns the estimated memory of all color buffers plus one depth-stencil buffer of the swap chain.
+    static std::uint64_t GetMemorySize(const LLGL::SwapChain& swapChain);
+
+private:
+    struct Entry
+    {
+        LLGL::SwapChain*                swapChain       = nullptr;
+        std::shared_ptr<LLGL::Window>   window;
+        int                             colorBits       = 0;
+        int                             depthBits       = 0;
+        int                             stencilBits     = 0;
+        std::uint32_t                   samples         = 1;
+        bool                            isDecorated     = false;
+        bool                            isAcquired      = false;
+        std::uint64_t                   releaseIndex    = 0;    // Value of 'numReleases' when the entry was released last
+    };
+
+private:
+    // Returns the size class of the resolution, i.e. the power of two each dimension rounds up to.
+    static std::uint32_t GetSizeClass(const LLGL::Extent2D& resolution);
+
+    void Destroy(Entry& entry);
+
+private:
+    std::vector<Entry>  entries;
+    std::uint64_t       numReleases = 0;
+    std::uint64_t       numCreated  = 0;
+    std::uint64_t       numReused   = 0;
+    std::uint64_t       numResized  = 0;
+};
+
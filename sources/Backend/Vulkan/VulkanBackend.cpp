@@ -18,6 +18,9 @@
 #include "imgui.h"
 #include "imgui_impl_vulkan.h"
 
+#include <algorithm>
+#include <vector>
+
 static VkFormat GetVulkanColorFormat(LLGL::Format format)
 {
     return (format == LLGL::Format::BGRA8UNorm ? VK_FORMAT_B8G8R8A8_UNORM : VK_FORMAT_R8G8B8A8_UNORM);
@@ -28,30 +31,32 @@ static VkFormat GetVulkanDepthStencilFormat(LLGL::Format format)
     return (format == LLGL::Format::D32Float ? VK_FORMAT_D32_SFLOAT : VK_FORMAT_D24_UNORM_S8_UINT);
 }
 
-static VkRenderPass CreateVulkanRenderPass(VkDevice vulkanDevice, LLGL::SwapChain& swapChain)
+// Creates a render pass that matches the scene render pass of the Backend: color and depth are cleared on load,
+// and only color is stored. ImGui renders inside that pass, so this object is only used for pipeline compatibility.
+static VkRenderPass CreateVulkanRenderPass(VkDevice vulkanDevice, VkFormat colorFormat, VkFormat depthStencilFormat)
 {
     VkAttachmentDescription vulkanAttachmentDescs[2] = {};
     {
         vulkanAttachmentDescs[0].flags          = 0;
-        vulkanAttachmentDescs[0].format         = GetVulkanColorFormat(swapChain.GetColorFormat());
+        vulkanAttachmentDescs[0].format         = colorFormat;
         vulkanAttachmentDescs[0].samples        = VK_SAMPLE_COUNT_1_BIT;
-        vulkanAttachmentDescs[0].loadOp         = VK_ATTACHMENT_LOAD_OP_LOAD;
+        vulkanAttachmentDescs[0].loadOp         = VK_ATTACHMENT_LOAD_OP_CLEAR;
         vulkanAttachmentDescs[0].storeOp        = VK_ATTACHMENT_STORE_OP_STORE;
-        vulkanAttachmentDescs[0].stencilLoadOp  = VK_ATTACHMENT_LOAD_OP_LOAD;
-        vulkanAttachmentDescs[0].stencilStoreOp = VK_ATTACHMENT_STORE_OP_STORE;
-        vulkanAttachmentDescs[0].initialLayout  = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+        vulkanAttachmentDescs[0].stencilLoadOp  = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        vulkanAttachmentDescs[0].stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        vulkanAttachmentDescs[0].initialLayout  = VK_IMAGE_LAYOUT_UNDEFINED;
         vulkanAttachmentDescs[0].finalLayout    = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
     }
     {
         vulkanAttachmentDescs[1].flags          = 0;
-        vulkanAttachmentDescs[1].format         = GetVulkanDepthStencilFormat(swapChain.GetDepthStencilFormat());
+        vulkanAttachmentDescs[1].format         = depthStencilFormat;
         vulkanAttachmentDescs[1].samples        = VK_SAMPLE_COUNT_1_BIT;
-        vulkanAttachmentDescs[1].loadOp         = VK_ATTACHMENT_LOAD_OP_LOAD;
-        vulkanAttachmentDescs[1].storeOp        = VK_ATTACHMENT_STORE_OP_STORE;
-        vulkanAttachmentDescs[1].stencilLoadOp  = VK_ATTACHMENT_LOAD_OP_LOAD;
-        vulkanAttachmentDescs[1].stencilStoreOp = VK_ATTACHMENT_STORE_OP_STORE;
-        vulkanAttachmentDescs[1].initialLayout  = VK_IMAGE_LAYOUT_DEPTH_ATTACHMENT_OPTIMAL_KHR;
-        vulkanAttachmentDescs[1].finalLayout    = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+        vulkanAttachmentDescs[1].loadOp         = VK_ATTACHMENT_LOAD_OP_CLEAR;
+        vulkanAttachmentDescs[1].storeOp        = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        vulkanAttachmentDescs[1].stencilLoadOp  = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        vulkanAttachmentDescs[1].stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        vulkanAttachmentDescs[1].initialLayout  = VK_IMAGE_LAYOUT_UNDEFINED;
+        vulkanAttachmentDescs[1].finalLayout    = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
     }
 
     VkAttachmentReference vulkanAttachmentRefs[2] = {};
@@ -61,7 +66,7 @@ static VkRenderPass CreateVulkanRenderPass(VkDevice vulkanDevice, LLGL::SwapChai
     }
     {
         vulkanAttachmentRefs[1].attachment  = 1;
-        vulkanAttachmentRefs[1].layout      = VK_IMAGE_LAYOUT_DEPTH_ATTACHMENT_OPTIMAL_KHR;
+        vulkanAttachmentRefs[1].layout      = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
     }
 
     VkSubpassDescription vulkanSubpassDescs[1] = {};
@@ -98,9 +103,38 @@ static VkRenderPass CreateVulkanRenderPass(VkDevice vulkanDevice, LLGL::SwapChai
 
 class VulkanBackend final : public Backend
 {
+    struct VulkanRenderPassEntry
+    {
+        VkFormat        colorFormat;
+        VkFormat        depthStencilFormat;
+        VkRenderPass    renderPass;
+    };
+
     // Global variables for the Vulkan backend
-    VkDevice        vulkanDevice        = VK_NULL_HANDLE;
-    VkRenderPass    vulkanRenderPass    = VK_NULL_HANDLE;
+    VkDevice                            vulkanDevice        = VK_NULL_HANDLE;
+    std::vector<VulkanRenderPassEntry>  vulkanRenderPasses;     // One render pass per combination of swap-chain formats
+
+    VkRenderPass GetOrCreateVulkanRenderPass(const LLGL::SwapChain& swapChain)
+    {
+        const VkFormat colorFormat = GetVulkanColorFormat(swapChain.GetColorFormat());
+        const VkFormat depthStencilFormat = GetVulkanDepthStencilFormat(swapChain.GetDepthStencilFormat());
+
+        for (const VulkanRenderPassEntry& entry : vulkanRenderPasses)
+        {
+            if (entry.colorFormat == colorFormat && entry.depthStencilFormat == depthStencilFormat)
+                return entry.renderPass;
+        }
+
+        VulkanRenderPassEntry entry;
+        {
+            entry.colorFormat           = colorFormat;
+            entry.depthStencilFormat    = depthStencilFormat;
+            entry.renderPass            = CreateVulkanRenderPass(vulkanDevice, colorFormat, depthStencilFormat);
+        }
+        vulkanRenderPasses.push_back(entry);
+
+        return entry.renderPass;
+    }
 
 public:
 
@@ -123,8 +157,8 @@ public:
 
     ~VulkanBackend()
     {
-        if (vulkanRenderPass != VK_NULL_HANDLE)
-            vkDestroyRenderPass(vulkanDevice, vulkanRenderPass, nullptr);
+        for (const VulkanRenderPassEntry& entry : vulkanRenderPasses)
+            vkDestroyRenderPass(vulkanDevice, entry.renderPass, nullptr);
     }
 
     void InitContext(WindowContext& context) override
@@ -136,8 +170,11 @@ public:
         renderer->GetNativeHandle(&nativeDeviceHandle, sizeof(nativeDeviceHandle));
         vulkanDevice = nativeDeviceHandle.device;
 
-        // Create Vulkan render pass
-        vulkanRenderPass = CreateVulkanRenderPass(vulkanDevice, *context.swapChain);
+        // Windows with the same swap-chain formats share their Vulkan render pass
+        VkRenderPass vulkanRenderPass = GetOrCreateVulkanRenderPass(*context.swapChain);
+
+        // ImGui keeps one set of vertex and index buffers per image; it requires at least two
+        const std::uint32_t imageCount = std::max(2u, context.swapChain->GetNumSwapBuffers());
 
         ImGui_ImplVulkan_InitInfo initInfo = {};
         {
@@ -149,8 +186,8 @@ public:
             initInfo.DescriptorPool     = VK_NULL_HANDLE;
             initInfo.DescriptorPoolSize = 64;
             initInfo.RenderPass         = vulkanRenderPass;
-            initInfo.MinImageCount      = 2;
-            initInfo.ImageCount         = 2;
+            initInfo.MinImageCount      = imageCount;
+            initInfo.ImageCount         = imageCount;
             initInfo.MSAASamples        = VK_SAMPLE_COUNT_1_BIT;
         }
         ImGui_ImplVulkan_Init(&initInfo);
@@ -179,6 +216,12 @@ public:
 
         ImGui_ImplVulkan_RenderDrawData(data, nativeContextHandle.commandBuffer);
     }
+
+    // The GUI is only recorded in EndFrame(), so frames can be recorded and presented on the render thread
+    bool IsRenderThreadSupported() const override
+    {
+        return true;
+    }
 };
 
 REGISTER_BACKEND(VulkanBackend, "Vulkan");
@@ -16,6 +16,12 @@ layout(binding = 1, std140) uniform View
     vec4 lightVector;
 };
 
+layout(binding = 2, std140) uniform Object
+{
+    mat4 objectMatrix;
+    vec4 objectColor;
+};
+
 layout(location = 0) in vec3 position;
 layout(location = 1) in vec3 normal;
 layout(location = 2) in vec4 color;
@@ -30,7 +36,7 @@ out gl_PerVertex
 
 void main()
 {
-    gl_Position = vpMatrix * (wMatrix * vec4(position, 1));
-    vNormal     = normalize(mat3(wMatrix) * normal);
-    vColor      = modelColor * color;
+    gl_Position = vpMatrix * (wMatrix * (objectMatrix * vec4(position, 1)));
+    vNormal     = normalize(mat3(wMatrix) * (mat3(objectMatrix) * normal));
+    vColor      = modelColor * objectColor * color;
 }
@@ -0,0 +1,22 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * Vulkan Upscale Fragment Shader
+ */
+
+#version 450 core
+
+layout(binding = 0) uniform texture2D colorMap;
+layout(binding = 1) uniform sampler colorMapSampler;
+
+layout(location = 0) in vec2 vTexCoord;
+
+layout(location = 0) out vec4 outColor;
+
+void main()
+{
+    outColor = texture(sampler2D(colorMap, colorMapSampler), vTexCoord);
+}
+
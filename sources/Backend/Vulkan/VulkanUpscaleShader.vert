@@ -0,0 +1,25 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * Vulkan Upscale Vertex Shader
+ */
+
+#version 450 core
+
+layout(location = 0) out vec2 vTexCoord;
+
+out gl_PerVertex
+{
+    vec4 gl_Position;
+};
+
+void main()
+{
+    // Full-screen triangle from the vertex index
+    vec2 position = vec2(float((gl_VertexIndex & 1) * 4 - 1), float((gl_VertexIndex & 2) * 2 - 1));
+    gl_Position = vec4(position, 0, 1);
+    vTexCoord   = position * 0.5 + 0.5;
+}
+
@@ -0,0 +1,228 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * Micro-benchmarks of the per-frame stages of the example
+ */
+
+#include <LLGL/LLGL.h>
+
+#include "Benchmark.h"
+#include "../Backend/Backend.h"
+#include "../Globals.h"
+#include "../MeshGenerator.h"
+#include "../MeshSimplifier.h"
+#include "../StressPanel.h"
+#include <string.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+
+struct BenchOptions
+{
+    BenchmarkOptions    benchmark;
+    const char*         jsonFilename        = nullptr;  // Output file for the results
+    const char*         baselineFilename    = nullptr;  // Results of a previous run to compare against
+    double              threshold           = 0.1;      // Maximum slowdown against the baseline before a benchmark counts as regression
+    std::uint32_t       numObjects          = 1024;     // Number of scene objects for command recording
+};
+
+static void ParseBenchOptions(int argc, char* argv[], BenchOptions& outOptions)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const char* arg = argv[i];
+        if (strncmp(arg, "--warmup=", 9) == 0)
+            outOptions.benchmark.numWarmupSamples = static_cast<std::uint32_t>(strtoul(arg + 9, nullptr, 10));
+        else if (strncmp(arg, "--samples=", 10) == 0)
+            outOptions.benchmark.numSamples = std::max(1u, static_cast<std::uint32_t>(strtoul(arg + 10, nullptr, 10)));
+        else if (strncmp(arg, "--min-time=", 11) == 0)
+            outOptions.benchmark.minSampleTime = strtod(arg + 11, nullptr) / 1000.0;
+        else if (strncmp(arg, "--filter=", 9) == 0)
+            outOptions.benchmark.filter = arg + 9;
+        else if (strncmp(arg, "--json=", 7) == 0)
+            outOptions.jsonFilename = arg + 7;
+        else if (strncmp(arg, "--baseline=", 11) == 0)
+            outOptions.baselineFilename = arg + 11;
+        else if (strncmp(arg, "--threshold=", 12) == 0)
+            outOptions.threshold = strtod(arg + 12, nullptr) / 100.0;
+        else if (strncmp(arg, "--objects=", 10) == 0)
+            outOptions.numObjects = std::max(1u, static_cast<std::uint32_t>(strtoul(arg + 10, nullptr, 10)));
+        else
+            LLGL::Log::Errorf(LLGL::Log::ColorFlags::StdError, "Unknown argument: %s\n", arg);
+    }
+}
+
+static void AddMathBenchmarks(BenchmarkSuite& suite)
+{
+    static View view;
+
+    suite.Add(
+        "ViewProjection",
+        []()
+        {
+            ViewProjection(view, 1.5f);
+        }
+    );
+    suite.Add(
+        "ModelRotation",
+        []()
+        {
+            ModelRotation(view, 1.0f, 1.0f, 1.0f, 0.5f);
+        }
+    );
+}
+
+static void AddMeshBenchmark(BenchmarkSuite& suite, const char* name, MeshType type, std::uint32_t tessellation)
+{
+    MeshDescriptor desc;
+    {
+        desc.type           = type;
+        desc.tessellation   = tessellation;
+    }
+
+    // Output arrays are shared across iterations, so only the generation itself is measured
+    const MeshSize size = GetMeshSize(desc);
+    auto vertices = std::make_shared<std::vector<Vertex>>(size.numVertices);
+    auto indices = std::make_shared<std::vector<std::uint32_t>>(size.numIndices);
+
+    suite.Add(
+        name,
+        [desc, vertices, indices]()
+        {
+            GenerateMesh(desc, vertices->data(), indices->data());
+        }
+    );
+}
+
+static void AddMeshLodBenchmark(BenchmarkSuite& suite, const char* name, MeshType type, std::uint32_t tessellation)
+{
+    MeshDescriptor desc;
+    {
+        desc.type           = type;
+        desc.tessellation   = tessellation;
+    }
+
+    // The mesh is generated once; each iteration builds the LOD chain from a copy of the full mesh
+    const MeshSize size = GetMeshSize(desc);
+    auto vertices = std::make_shared<std::vector<Vertex>>(size.numVertices);
+    auto fullIndices = std::make_shared<std::vector<std::uint32_t>>(size.numIndices);
+    auto indices = std::make_shared<std::vector<std::uint32_t>>();
+    GenerateMesh(desc, vertices->data(), fullIndices->data());
+
+    suite.Add(
+        name,
+        [vertices, fullIndices, indices]()
+        {
+            indices->assign(fullIndices->begin(), fullIndices->end());
+            BuildMeshLods(*indices, vertices->data(), static_cast<std::uint32_t>(vertices->size()));
+        }
+    );
+}
+
+static void AddBackendBenchmarks(BenchmarkSuite& suite)
+{
+    Backend::WindowContext& context = g_backend->GetWindowContext(0);
+
+    suite.Add(
+        "ProcessMouseInput",
+        [&context]()
+        {
+            g_backend->ProcessInputForContext(context);
+        }
+    );
+    suite.Add(
+        "ShowImGuiElements",
+        [&context]()
+        {
+            g_backend->BuildGUIForContext(context, 1.0f/60.0f);
+            context.imGuiAllocator->NextFrame();
+        }
+    );
+
+    // Without the producer thread, the dataset of the stress test stays the same across iterations and runs
+    StressPanel::Get().Reset(StressPanel::Config{});
+    suite.Add(
+        "ShowImGuiElements/Stress",
+        [&context]()
+        {
+            context.showcase.showStressPanel = true;
+            g_backend->BuildGUIForContext(context, 1.0f/60.0f);
+            context.imGuiAllocator->NextFrame();
+            context.showcase.showStressPanel = false;
+        }
+    );
+    suite.Add(
+        "RecordCommands/Null",
+        [&context]()
+        {
+            g_backend->RecordSceneForContext(context);
+        }
+    );
+}
+
+int main(int argc, char* argv[])
+{
+    LLGL::Log::RegisterCallbackStd();
+
+    BenchOptions benchOptions;
+    ParseBenchOptions(argc, argv, benchOptions);
+
+    // The Null renderer records commands without a GPU, so only CPU costs are measured
+    g_backend = Backend::NewBackend("Null");
+    if (!g_backend || !renderer)
+    {
+        LLGL::Log::Errorf(LLGL::Log::ColorFlags::StdError, "Failed to initialize Null backend!\n");
+        return 1;
+    }
+    g_backend->Init();
+
+    // Render a few frames, so the requested objects exist and have been culled before recording commands
+    scene.nextNumObjects    = benchOptions.numObjects;
+    scene.areObjectsDirty   = true;
+    for (int i = 0; i < 3; ++i)
+        g_backend->RenderSceneForAllContexts();
+
+    BenchmarkSuite suite;
+    AddMathBenchmarks(suite);
+    AddMeshBenchmark(suite, "GenerateMesh/Cube16", MeshType::Cube, 16);
+    AddMeshBenchmark(suite, "GenerateMesh/Sphere64", MeshType::Sphere, 64);
+    AddMeshBenchmark(suite, "GenerateMesh/Torus256", MeshType::Torus, 256);
+    AddMeshLodBenchmark(suite, "BuildMeshLods/Sphere64", MeshType::Sphere, 64);
+    AddBackendBenchmarks(suite);
+
+    const std::vector<BenchmarkStats> results = suite.Run(benchOptions.benchmark);
+
+    int exitCode = 0;
+
+    if (benchOptions.jsonFilename != nullptr && !WriteBenchmarkJSON(benchOptions.jsonFilename, results))
+    {
+        LLGL::Log::Errorf(LLGL::Log::ColorFlags::StdError, "Failed to write benchmark results: %s\n", benchOptions.jsonFilename);
+        exitCode = 1;
+    }
+
+    if (benchOptions.baselineFilename != nullptr)
+    {
+        std::map<std::string, double> baseline;
+        if (!ReadBenchmarkBaseline(benchOptions.baselineFilename, baseline))
+        {
+            LLGL::Log::Errorf(LLGL::Log::ColorFlags::StdError, "Failed to read benchmark baseline: %s\n", benchOptions.baselineFilename);
+            exitCode = 1;
+        }
+        else if (std::uint32_t numRegressions = CompareWithBaseline(results, baseline, benchOptions.threshold))
+        {
+            LLGL::Log::Errorf(LLGL::Log::ColorFlags::StdError, "%u benchmark(s) regressed by more than %.1f%%\n", numRegressions, benchOptions.threshold * 100.0);
+            exitCode = 1;
+        }
+    }
+
+    g_backend->Release();
+    g_backend.reset();
+    LLGL::RenderSystem::Unload(std::move(renderer));
+
+    return exitCode;
+}
+
@@ -0,0 +1,201 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * Benchmark.cpp
+ */
+
+#include "Benchmark.h"
+#include <LLGL/LLGL.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+
+// Upper bound of iterations per sample, so benchmarks whose first runs are unusually fast can't run for minutes
+static constexpr std::uint64_t g_maxIterationsPerSample = 1u << 24;
+
+static double TicksToNanoseconds(std::uint64_t ticks)
+{
+    return static_cast<double>(ticks) * 1.0e9 / static_cast<double>(LLGL::Timer::Frequency());
+}
+
+// Runs the function the specified number of times and returns the elapsed time in nanoseconds
+static double RunIterations(const BenchmarkSuite::BenchmarkFunc& func, std::uint64_t numIterations)
+{
+    const std::uint64_t startTick = LLGL::Timer::Tick();
+    for (std::uint64_t i = 0; i < numIterations; ++i)
+        func();
+    return TicksToNanoseconds(LLGL::Timer::Tick() - startTick);
+}
+
+// Doubles the number of iterations until a sample takes at least the minimum sample time
+static std::uint64_t CalibrateIterations(const BenchmarkSuite::BenchmarkFunc& func, double minSampleTime)
+{
+    const double minSampleTimeNs = minSampleTime * 1.0e9;
+
+    std::uint64_t numIterations = 1;
+    while (numIterations < g_maxIterationsPerSample && RunIterations(func, numIterations) < minSampleTimeNs)
+        numIterations *= 2;
+
+    return numIterations;
+}
+
+static BenchmarkStats ComputeStats(const std::string& name, std::vector<double>& samples, std::uint64_t numIterations)
+{
+    BenchmarkStats stats;
+    stats.name          = name;
+    stats.numSamples    = static_cast<std::uint32_t>(samples.size());
+    stats.numIterations = numIterations;
+
+    if (samples.empty())
+        return stats;
+
+    std::sort(samples.begin(), samples.end());
+
+    const std::size_t n = samples.size();
+    double sum = 0.0;
+    for (double sample : samples)
+        sum += sample;
+
+    stats.mean      = sum / static_cast<double>(n);
+    stats.median    = (n % 2 == 1 ? samples[n/2] : (samples[n/2 - 1] + samples[n/2]) * 0.5);
+    stats.min       = samples.front();
+    stats.max       = samples.back();
+
+    double variance = 0.0;
+    for (double sample : samples)
+        variance += (sample - stats.mean) * (sample - stats.mean);
+    stats.stdDev = (n > 1 ? std::sqrt(variance / static_cast<double>(n - 1)) : 0.0);
+
+    return stats;
+}
+
+void BenchmarkSuite::Add(const char* name, const BenchmarkFunc& func)
+{
+    Benchmark benchmark;
+    {
+        benchmark.name = name;
+        benchmark.func = func;
+    }
+    benchmarks.push_back(benchmark);
+}
+
+std::vector<BenchmarkStats> BenchmarkSuite::Run(const BenchmarkOptions& options) const
+{
+    std::vector<BenchmarkStats> results;
+
+    std::printf("%-32s %12s %12s %12s %12s %10s\n", "Benchmark", "Median [ns]", "Mean [ns]", "Min [ns]", "Max [ns]", "StdDev");
+
+    std::vector<double> samples;
+    samples.reserve(options.numSamples);
+
+    for (const Benchmark& benchmark : benchmarks)
+    {
+        if (options.filter != nullptr && benchmark.name.find(options.filter) == std::string::npos)
+            continue;
+
+        const std::uint64_t numIterations = CalibrateIterations(benchmark.func, options.minSampleTime);
+
+        for (std::uint32_t i = 0; i < options.numWarmupSamples; ++i)
+            RunIterations(benchmark.func, numIterations);
+
+        samples.clear();
+        for (std::uint32_t i = 0; i < options.numSamples; ++i)
+            samples.push_back(RunIterations(benchmark.func, numIterations) / static_cast<double>(numIterations));
+
+        const BenchmarkStats stats = ComputeStats(benchmark.name, samples, numIterations);
+        std::printf(
+            "%-32s %12.1f %12.1f %12.1f %12.1f %9.1f%%\n",
+            stats.name.c_str(), stats.median, stats.mean, stats.min, stats.max,
+            (stats.mean > 0.0 ? stats.stdDev / stats.mean * 100.0 : 0.0)
+        );
+        results.push_back(stats);
+    }
+
+    return results;
+}
+
+bool WriteBenchmarkJSON(const char* filename, const std::vector<BenchmarkStats>& results)
+{
+    FILE* file = std::fopen(filename, "w");
+    if (file == nullptr)
+        return false;
+
+    std::fprintf(file, "[\n");
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        const BenchmarkStats& stats = results[i];
+        std::fprintf(
+            file,
+            "  { \"name\": \"%s\", \"samples\": %u, \"iterations\": %llu, \"median_ns\": %.3f, \"mean_ns\": %.3f, \"min_ns\": %.3f, \"max_ns\": %.3f, \"stddev_ns\": %.3f }%s\n",
+            stats.name.c_str(), stats.numSamples, static_cast<unsigned long long>(stats.numIterations),
+            stats.median, stats.mean, stats.min, stats.max, stats.stdDev,
+            (i + 1 < results.size() ? "," : "")
+        );
+    }
+    std::fprintf(file, "]\n");
+
+    return (std::fclose(file) == 0);
+}
+
+bool ReadBenchmarkBaseline(const char* filename, std::map<std::string, double>& outMedians)
+{
+    FILE* file = std::fopen(filename, "r");
+    if (file == nullptr)
+        return false;
+
+    // Only the line based format of WriteBenchmarkJSON() is supported; benchmark names never contain quotes
+    char line[1024];
+    while (std::fgets(line, sizeof(line), file) != nullptr)
+    {
+        const char* nameKey = std::strstr(line, "\"name\": \"");
+        const char* medianKey = std::strstr(line, "\"median_ns\": ");
+        if (nameKey == nullptr || medianKey == nullptr)
+            continue;
+
+        const char* nameBegin = nameKey + std::strlen("\"name\": \"");
+        const char* nameEnd = std::strchr(nameBegin, '"');
+        if (nameEnd == nullptr)
+            continue;
+
+        double median = 0.0;
+        if (std::sscanf(medianKey + std::strlen("\"median_ns\": "), "%lf", &median) == 1)
+            outMedians[std::string(nameBegin, nameEnd)] = median;
+    }
+
+    std::fclose(file);
+    return true;
+}
+
+std::uint32_t CompareWithBaseline(const std::vector<BenchmarkStats>& results, const std::map<std::string, double>& baseline, double threshold)
+{
+    std::uint32_t numRegressions = 0;
+
+    std::printf("\n%-32s %12s %12s %10s\n", "Benchmark", "Base [ns]", "New [ns]", "Change");
+
+    for (const BenchmarkStats& stats : results)
+    {
+        auto it = baseline.find(stats.name);
+        if (it == baseline.end() || it->second <= 0.0)
+        {
+            std::printf("%-32s %12s %12.1f %10s\n", stats.name.c_str(), "-", stats.median, "new");
+            continue;
+        }
+
+        const double change = stats.median / it->second - 1.0;
+        const bool isRegression = (change > threshold);
+        if (isRegression)
+            ++numRegressions;
+
+        std::printf(
+            "%-32s %12.1f %12.1f %+9.1f%%%s\n",
+            stats.name.c_str(), it->second, stats.median, change * 100.0, (isRegression ? "  REGRESSION" : "")
+        );
+    }
+
+    return numRegressions;
+}
+
@@ -0,0 +1,70 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * Benchmark.h
+ */
+
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+#include <map>
+#include <cstdint>
+
+
+struct BenchmarkOptions
+{
+    std::uint32_t   numWarmupSamples    = 5;        // Samples to run before measuring, e.g. to fill caches and pools
+    std::uint32_t   numSamples          = 30;       // Measured samples per benchmark
+    double          minSampleTime       = 0.005;    // Minimum duration of a sample in seconds; short benchmarks run multiple iterations per sample
+    const char*     filter              = nullptr;  // Only run benchmarks whose name contains this string
+};
+
+// Statistics of a single benchmark; all times are in nanoseconds per iteration.
+struct BenchmarkStats
+{
+    std::string     name;
+    std::uint32_t   numSamples          = 0;
+    std::uint64_t   numIterations       = 0;        // Iterations per sample
+    double          mean                = 0.0;
+    double          median              = 0.0;
+    double          min                 = 0.0;
+    double          max                 = 0.0;
+    double          stdDev              = 0.0;
+};
+
+class BenchmarkSuite
+{
+public:
+    using BenchmarkFunc = std::function<void()>;
+
+public:
+    void Add(const char* name, const BenchmarkFunc& func);
+
+    // Runs all benchmarks that pass the filter and prints a summary line for each of them.
+    std::vector<BenchmarkStats> Run(const BenchmarkOptions& options) const;
+
+private:
+    struct Benchmark
+    {
+        std::string     name;
+        BenchmarkFunc   func;
+    };
+
+private:
+    std::vector<Benchmark> benchmarks;
+};
+
+// Writes the results as JSON array with one benchmark object per line.
+bool WriteBenchmarkJSON(const char* filename, const std::vector<BenchmarkStats>& results);
+
+// Reads the median times of a file written by WriteBenchmarkJSON().
+bool ReadBenchmarkBaseline(const char* filename, std::map<std::string, double>& outMedians);
+
+// Prints the change of each median against the baseline. Returns the number of benchmarks that are slower
+// than their baseline by more than 'threshold', e.g. 0.1 for 10%.
+std::uint32_t CompareWithBaseline(const std::vector<BenchmarkStats>& results, const std::map<std::string, double>& baseline, double threshold);
+
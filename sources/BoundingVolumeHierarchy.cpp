@@ -0,0 +1,349 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * BoundingVolumeHierarchy.cpp
+ */
+
+#include "BoundingVolumeHierarchy.h"
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#   define BVH4_USE_SSE 1
+#   include <xmmintrin.h>
+#else
+#   define BVH4_USE_SSE 0
+#endif
+
+
+Frustum ExtractFrustum(const float (&m)[4][4], bool isUnitCube)
+{
+    // Row i of the matrix is (m[0][i], m[1][i], m[2][i], m[3][i])
+    auto SetPlane = [&m](float (&plane)[4], int row, float sign, bool addW)
+    {
+        for (int i = 0; i < 4; ++i)
+            plane[i] = (addW ? m[i][3] : 0.0f) + sign * m[i][row];
+    };
+
+    Frustum frustum;
+    SetPlane(frustum.planes[0], 0, +1.0f, true);        // left
+    SetPlane(frustum.planes[1], 0, -1.0f, true);        // right
+    SetPlane(frustum.planes[2], 1, +1.0f, true);        // bottom
+    SetPlane(frustum.planes[3], 1, -1.0f, true);        // top
+    SetPlane(frustum.planes[4], 2, +1.0f, isUnitCube);  // near
+    SetPlane(frustum.planes[5], 2, -1.0f, true);        // far
+    return frustum;
+}
+
+AABB TransformAABB(const AABB& box, const float (&m)[4][4])
+{
+    float center[3], extent[3];
+    for (int i = 0; i < 3; ++i)
+    {
+        center[i] = (box.min[i] + box.max[i]) * 0.5f;
+        extent[i] = (box.max[i] - box.min[i]) * 0.5f;
+    }
+
+    AABB result;
+    for (int row = 0; row < 3; ++row)
+    {
+        const float c = m[0][row]*center[0] + m[1][row]*center[1] + m[2][row]*center[2] + m[3][row];
+        const float e = std::abs(m[0][row])*extent[0] + std::abs(m[1][row])*extent[1] + std::abs(m[2][row])*extent[2];
+        result.min[row] = c - e;
+        result.max[row] = c + e;
+    }
+    return result;
+}
+
+static void MergeAABB(AABB& dst, const AABB& src)
+{
+    for (int i = 0; i < 3; ++i)
+    {
+        dst.min[i] = std::min(dst.min[i], src.min[i]);
+        dst.max[i] = std::max(dst.max[i], src.max[i]);
+    }
+}
+
+// Splits [begin, end) at the median of the object centers along their largest axis
+static std::uint32_t SplitAtMedian(std::uint32_t* order, std::uint32_t begin, std::uint32_t end, const std::vector<float>& centers)
+{
+    float minCenter[3] = { +1e30f, +1e30f, +1e30f };
+    float maxCenter[3] = { -1e30f, -1e30f, -1e30f };
+    for (std::uint32_t i = begin; i < end; ++i)
+    {
+        for (int k = 0; k < 3; ++k)
+        {
+            minCenter[k] = std::min(minCenter[k], centers[order[i]*3 + k]);
+            maxCenter[k] = std::max(maxCenter[k], centers[order[i]*3 + k]);
+        }
+    }
+
+    int axis = 0;
+    for (int k = 1; k < 3; ++k)
+    {
+        if (maxCenter[k] - minCenter[k] > maxCenter[axis] - minCenter[axis])
+            axis = k;
+    }
+
+    const std::uint32_t mid = begin + (end - begin)/2;
+    std::nth_element(
+        order + begin, order + mid, order + end,
+        [&centers, axis](std::uint32_t lhs, std::uint32_t rhs) -> bool
+        {
+            return (centers[lhs*3 + axis] < centers[rhs*3 + axis]);
+        }
+    );
+    return mid;
+}
+
+void BVH4::Build(const AABB* bounds, std::uint32_t numObjects)
+{
+    nodes.clear();
+    if (numObjects == 0)
+        return;
+
+    std::vector<float> centers(numObjects * 3);
+    for (std::uint32_t i = 0; i < numObjects; ++i)
+    {
+        for (int k = 0; k < 3; ++k)
+            centers[i*3 + k] = (bounds[i].min[k] + bounds[i].max[k]) * 0.5f;
+    }
+
+    objectOrder.resize(numObjects);
+    for (std::uint32_t i = 0; i < numObjects; ++i)
+        objectOrder[i] = i;
+
+    nodes.reserve(numObjects / 2 + 1);
+    BuildNode(0, numObjects, bounds, centers);
+}
+
+std::int32_t BVH4::BuildNode(std::uint32_t begin, std::uint32_t end, const AABB* bounds, const std::vector<float>& centers)
+{
+    const std::int32_t nodeIndex = static_cast<std::int32_t>(nodes.size());
+    nodes.emplace_back();
+
+    // Partition into up to four ranges: one per object for small ranges, otherwise two levels of median splits
+    std::uint32_t ranges[5] = { begin, begin, begin, begin, begin };
+    std::uint32_t numRanges = 0;
+
+    if (end - begin <= 4)
+    {
+        for (std::uint32_t i = begin; i <= end; ++i)
+            ranges[numRanges++] = i;
+        --numRanges;
+    }
+    else
+    {
+        const std::uint32_t mid = SplitAtMedian(objectOrder.data(), begin, end, centers);
+        ranges[0] = begin;
+        ranges[1] = SplitAtMedian(objectOrder.data(), begin, mid, centers);
+        ranges[2] = mid;
+        ranges[3] = SplitAtMedian(objectOrder.data(), mid, end, centers);
+        ranges[4] = end;
+        numRanges = 4;
+    }
+
+    for (std::uint32_t slot = 0; slot < numRanges; ++slot)
+    {
+        std::int32_t child;
+        AABB childBounds;
+
+        if (ranges[slot + 1] - ranges[slot] == 1)
+        {
+            const std::uint32_t objectIndex = objectOrder[ranges[slot]];
+            child       = ~static_cast<std::int32_t>(objectIndex);
+            childBounds = bounds[objectIndex];
+        }
+        else
+        {
+            child       = BuildNode(ranges[slot], ranges[slot + 1], bounds, centers);
+            childBounds = GetNodeBounds(child);
+        }
+
+        Node& node = nodes[nodeIndex];
+        node.children[slot] = child;
+        SetChildBounds(node, slot, childBounds);
+    }
+
+    Node& node = nodes[nodeIndex];
+    node.numChildren = numRanges;
+
+    // Unused slots are still tested by the SIMD path, but never visited since they are beyond 'numChildren'
+    for (std::uint32_t slot = numRanges; slot < 4; ++slot)
+    {
+        node.children[slot] = 0;
+        SetChildBounds(node, slot, AABB{});
+    }
+
+    return nodeIndex;
+}
+
+void BVH4::SetChildBounds(Node& node, std::uint32_t slot, const AABB& box)
+{
+    node.minX[slot] = box.min[0];
+    node.minY[slot] = box.min[1];
+    node.minZ[slot] = box.min[2];
+    node.maxX[slot] = box.max[0];
+    node.maxY[slot] = box.max[1];
+    node.maxZ[slot] = box.max[2];
+}
+
+AABB BVH4::GetNodeBounds(std::int32_t nodeIndex) const
+{
+    const Node& node = nodes[nodeIndex];
+
+    AABB box;
+    for (std::uint32_t slot = 0; slot < node.numChildren; ++slot)
+    {
+        AABB childBounds;
+        childBounds.min[0] = node.minX[slot];
+        childBounds.min[1] = node.minY[slot];
+        childBounds.min[2] = node.minZ[slot];
+        childBounds.max[0] = node.maxX[slot];
+        childBounds.max[1] = node.maxY[slot];
+        childBounds.max[2] = node.maxZ[slot];
+
+        if (slot == 0)
+            box = childBounds;
+        else
+            MergeAABB(box, childBounds);
+    }
+    return box;
+}
+
+void BVH4::Refit(const AABB* bounds)
+{
+    // Children have larger indices than their parents, so a reverse sweep visits them first
+    for (std::size_t i = nodes.size(); i-- > 0;)
+    {
+        Node& node = nodes[i];
+        for (std::uint32_t slot = 0; slot < node.numChildren; ++slot)
+        {
+            const std::int32_t child = node.children[slot];
+            if (child < 0)
+                SetChildBounds(node, slot, bounds[~child]);
+            else
+                SetChildBounds(node, slot, GetNodeBounds(child));
+        }
+    }
+}
+
+void BVH4::CollectObjects(std::int32_t child, std::vector<std::uint32_t>& outVisible) const
+{
+    if (child < 0)
+    {
+        outVisible.push_back(static_cast<std::uint32_t>(~child));
+        return;
+    }
+
+    const Node& node = nodes[child];
+    for (std::uint32_t slot = 0; slot < node.numChildren; ++slot)
+        CollectObjects(node.children[slot], outVisible);
+}
+
+// Tests the four child boxes of a node against all frustum planes.
+// Bit i of 'outIntersect' is set if child i is at least partially inside, bit i of 'outInside' if it is fully inside.
+static void TestNodeBounds(
+    const float*    minX,
+    const float*    minY,
+    const float*    minZ,
+    const float*    maxX,
+    const float*    maxY,
+    const float*    maxZ,
+    const Frustum&  frustum,
+    int&            outIntersect,
+    int&            outInside)
+{
+    #if BVH4_USE_SSE
+
+    const __m128 bMinX = _mm_load_ps(minX);
+    const __m128 bMinY = _mm_load_ps(minY);
+    const __m128 bMinZ = _mm_load_ps(minZ);
+    const __m128 bMaxX = _mm_load_ps(maxX);
+    const __m128 bMaxY = _mm_load_ps(maxY);
+    const __m128 bMaxZ = _mm_load_ps(maxZ);
+    const __m128 zero  = _mm_setzero_ps();
+
+    __m128 intersect    = _mm_cmpeq_ps(zero, zero);
+    __m128 inside       = intersect;
+
+    for (const float (&plane)[4] : frustum.planes)
+    {
+        const __m128 a = _mm_set1_ps(plane[0]);
+        const __m128 b = _mm_set1_ps(plane[1]);
+        const __m128 c = _mm_set1_ps(plane[2]);
+        const __m128 d = _mm_set1_ps(plane[3]);
+
+        const __m128 x0 = _mm_mul_ps(a, bMinX), x1 = _mm_mul_ps(a, bMaxX);
+        const __m128 y0 = _mm_mul_ps(b, bMinY), y1 = _mm_mul_ps(b, bMaxY);
+        const __m128 z0 = _mm_mul_ps(c, bMinZ), z1 = _mm_mul_ps(c, bMaxZ);
+
+        // Signed distances of the box corners farthest along and against the plane normal
+        const __m128 distMax = _mm_add_ps(_mm_add_ps(_mm_max_ps(x0, x1), _mm_max_ps(y0, y1)), _mm_add_ps(_mm_max_ps(z0, z1), d));
+        const __m128 distMin = _mm_add_ps(_mm_add_ps(_mm_min_ps(x0, x1), _mm_min_ps(y0, y1)), _mm_add_ps(_mm_min_ps(z0, z1), d));
+
+        intersect   = _mm_and_ps(intersect, _mm_cmpge_ps(distMax, zero));
+        inside      = _mm_and_ps(inside, _mm_cmpge_ps(distMin, zero));
+    }
+
+    outIntersect    = _mm_movemask_ps(intersect);
+    outInside       = _mm_movemask_ps(inside);
+
+    #else
+
+    outIntersect    = 0xF;
+    outInside       = 0xF;
+
+    for (int i = 0; i < 4; ++i)
+    {
+        for (const float (&plane)[4] : frustum.planes)
+        {
+            const float x0 = plane[0]*minX[i], x1 = plane[0]*maxX[i];
+            const float y0 = plane[1]*minY[i], y1 = plane[1]*maxY[i];
+            const float z0 = plane[2]*minZ[i], z1 = plane[2]*maxZ[i];
+
+            if (std::max(x0, x1) + std::max(y0, y1) + std::max(z0, z1) + plane[3] < 0.0f)
+                outIntersect &= ~(1 << i);
+            if (std::min(x0, x1) + std::min(y0, y1) + std::min(z0, z1) + plane[3] < 0.0f)
+                outInside &= ~(1 << i);
+        }
+    }
+
+    #endif
+}
+
+void BVH4::Cull(const Frustum& frustum, std::vector<std::uint32_t>& outVisible) const
+{
+    if (nodes.empty())
+        return;
+
+    std::int32_t stack[64];
+    int stackSize = 0;
+    stack[stackSize++] = 0;
+
+    while (stackSize > 0)
+    {
+        const Node& node = nodes[stack[--stackSize]];
+
+        int intersectMask = 0, insideMask = 0;
+        TestNodeBounds(node.minX, node.minY, node.minZ, node.maxX, node.maxY, node.maxZ, frustum, intersectMask, insideMask);
+
+        for (std::uint32_t slot = 0; slot < node.numChildren; ++slot)
+        {
+            const int bit = (1 << slot);
+            if ((intersectMask & bit) == 0)
+                continue;
+
+            const std::int32_t child = node.children[slot];
+            if (child < 0)
+                outVisible.push_back(static_cast<std::uint32_t>(~child));
+            else if ((insideMask & bit) != 0)
+                CollectObjects(child, outVisible);
+            else
+                stack[stackSize++] = child;
+        }
+    }
+}
+
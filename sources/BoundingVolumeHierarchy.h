@@ -0,0 +1,76 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * BoundingVolumeHierarchy.h
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+
+struct AABB
+{
+    float   min[3]  = { 0.0f, 0.0f, 0.0f };
+    float   max[3]  = { 0.0f, 0.0f, 0.0f };
+};
+
+// Six clipping planes (a, b, c, d) where a point p is inside if dot(abc, p) + d >= 0 for all planes.
+struct Frustum
+{
+    float   planes[6][4];
+};
+
+// Extracts the frustum planes from a column-major view-projection matrix, i.e. m[column][row].
+// 'isUnitCube' selects the clipping range [-1, +1] instead of [0, 1] for the near plane.
+Frustum ExtractFrustum(const float (&m)[4][4], bool isUnitCube);
+
+// Returns the world space AABB of a local AABB transformed by a column-major affine matrix.
+AABB TransformAABB(const AABB& box, const float (&m)[4][4]);
+
+// Four-wide bounding volume hierarchy over object AABBs. Each node stores the bounds of its
+// four children in SoA layout so one node is tested against a frustum plane with a single SIMD operation.
+class BVH4
+{
+public:
+    // Builds the tree top-down by median splits along the largest axis of the object centers.
+    void Build(const AABB* bounds, std::uint32_t numObjects);
+
+    // Updates all node bounds bottom-up without changing the topology, e.g. after objects rotated.
+    void Refit(const AABB* bounds);
+
+    // Appends the indices of all objects whose AABB intersects the frustum.
+    void Cull(const Frustum& frustum, std::vector<std::uint32_t>& outVisible) const;
+
+    std::uint32_t GetNumNodes() const
+    {
+        return static_cast<std::uint32_t>(nodes.size());
+    }
+
+private:
+    struct alignas(16) Node
+    {
+        float           minX[4];
+        float           minY[4];
+        float           minZ[4];
+        float           maxX[4];
+        float           maxY[4];
+        float           maxZ[4];
+        std::int32_t    children[4];    // Node index if >= 0, otherwise ~objectIndex
+        std::uint32_t   numChildren;
+    };
+
+private:
+    std::int32_t BuildNode(std::uint32_t begin, std::uint32_t end, const AABB* bounds, const std::vector<float>& centers);
+    void SetChildBounds(Node& node, std::uint32_t slot, const AABB& box);
+    AABB GetNodeBounds(std::int32_t nodeIndex) const;
+    void CollectObjects(std::int32_t child, std::vector<std::uint32_t>& outVisible) const;
+
+private:
+    std::vector<Node>           nodes;          // Parents always precede their children
+    std::vector<std::uint32_t>  objectOrder;    // Scratch buffer for the build
+};
+
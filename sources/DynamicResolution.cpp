@@ -0,0 +1,88 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * DynamicResolution.cpp
+ */
+
+#include "DynamicResolution.h"
+
+
+// Weight of the newest frame time in the moving average
+static constexpr float          g_smoothingFactor       = 0.1f;
+
+// Scale down once the average exceeds the budget by this factor for several frames in a row
+static constexpr float          g_overBudgetFactor      = 1.05f;
+static constexpr std::uint32_t  g_numFramesToScaleDown  = 8;
+
+// Scale up only if the next level is predicted to stay below this fraction of the budget for many frames in a row;
+// the gap between both factors is the hysteresis
+static constexpr float          g_underBudgetFactor     = 0.85f;
+static constexpr std::uint32_t  g_numFramesToScaleUp    = 60;
+
+// Frames to skip after a level change, so the moving average can settle at the new resolution
+static constexpr std::uint32_t  g_numCooldownFrames     = 30;
+
+float DynamicResolution::GetLevelScale(std::uint32_t level)
+{
+    return 0.5f + 0.5f * static_cast<float>(level) / static_cast<float>(numLevels - 1);
+}
+
+bool DynamicResolution::Update(float frameTime)
+{
+    if (smoothedFrameTime <= 0.0f)
+        smoothedFrameTime = frameTime;
+    else
+        smoothedFrameTime += (frameTime - smoothedFrameTime) * g_smoothingFactor;
+
+    if (numCooldownFrames > 0)
+    {
+        --numCooldownFrames;
+        return false;
+    }
+
+    const std::uint32_t prevLevel = level;
+
+    // Scale down if the budget is exceeded consistently
+    if (level > 0 && smoothedFrameTime > targetFrameTime * g_overBudgetFactor)
+    {
+        if (++numFramesOver >= g_numFramesToScaleDown)
+            --level;
+    }
+    else
+        numFramesOver = 0;
+
+    // Scale up if the frame time at the next level, estimated by its number of pixels, leaves enough headroom
+    if (level == prevLevel && level + 1 < numLevels)
+    {
+        const float pixelRatio = GetLevelScale(level + 1) / GetLevelScale(level);
+        const float predictedFrameTime = smoothedFrameTime * pixelRatio * pixelRatio;
+        if (predictedFrameTime < targetFrameTime * g_underBudgetFactor)
+        {
+            if (++numFramesUnder >= g_numFramesToScaleUp)
+                ++level;
+        }
+        else
+            numFramesUnder = 0;
+    }
+
+    if (level == prevLevel)
+        return false;
+
+    numFramesOver       = 0;
+    numFramesUnder      = 0;
+    numCooldownFrames   = g_numCooldownFrames;
+
+    return true;
+}
+
+void DynamicResolution::Reset()
+{
+    level               = numLevels - 1;
+    smoothedFrameTime   = 0.0f;
+    numFramesOver       = 0;
+    numFramesUnder      = 0;
+    numCooldownFrames   = 0;
+}
+
@@ -0,0 +1,56 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * DynamicResolution.h
+ */
+
+#pragma once
+
+#include <cstdint>
+
+
+// Picks the render scale of the scene from measured frame times against a frame budget.
+// The scale only changes in discrete levels, so the render graph keeps reusing a few pooled scene targets,
+// and hysteresis keeps the scale from oscillating between two neighboring levels.
+class DynamicResolution
+{
+public:
+    static constexpr std::uint32_t numLevels = 5;
+
+    // Returns the render scale of the specified level, from 50% to 100% in steps of 12.5%.
+    static float GetLevelScale(std::uint32_t level);
+
+    // Feeds the frame time of the last frame in seconds. Returns true if the level has changed.
+    bool Update(float frameTime);
+
+    // Returns to full resolution and discards the frame time history.
+    void Reset();
+
+    std::uint32_t GetLevel() const
+    {
+        return level;
+    }
+
+    float GetScale() const
+    {
+        return GetLevelScale(level);
+    }
+
+    float GetSmoothedFrameTime() const
+    {
+        return smoothedFrameTime;
+    }
+
+public:
+    float           targetFrameTime     = 1.0f/60.0f;   // Frame budget in seconds
+
+private:
+    std::uint32_t   level               = numLevels - 1;
+    float           smoothedFrameTime   = 0.0f;         // Exponential moving average of the frame time
+    std::uint32_t   numFramesOver       = 0;            // Consecutive frames over budget
+    std::uint32_t   numFramesUnder      = 0;            // Consecutive frames with enough headroom for the next level
+    std::uint32_t   numCooldownFrames   = 0;            // Frames to wait after a level change before measuring again
+};
+
@@ -0,0 +1,27 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * EmbeddedShaders.cpp
+ */
+
+#include "EmbeddedShaders.h"
+#include <cstring>
+
+
+const EmbeddedShader* FindEmbeddedShader(const char* path)
+{
+    // Shader filenames are unique across all backends, so the directory is ignored
+    const char* filename = std::strrchr(path, '/');
+    filename = (filename != nullptr ? filename + 1 : path);
+
+    for (const EmbeddedShader* shader = g_embeddedShaders; shader->filename != nullptr; ++shader)
+    {
+        if (std::strcmp(shader->filename, filename) == 0)
+            return shader;
+    }
+
+    return nullptr;
+}
+
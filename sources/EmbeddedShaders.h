@@ -0,0 +1,27 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * EmbeddedShaders.h
+ */
+
+#pragma once
+
+#include <cstddef>
+
+
+// Shader file that the build compiled into the executable with EmbedShaders.cmake.
+struct EmbeddedShader
+{
+    const char*             filename;   // Filename without directory, e.g. "OpenGLSceneShader.vert"
+    const unsigned char*    data;       // File contents followed by a null terminator, so text shaders can be used as code string
+    std::size_t             size;       // Size of the file in bytes, excluding the null terminator
+};
+
+// Table of all embedded shaders, terminated by an entry with a null filename; defined in the generated source file.
+extern const EmbeddedShader g_embeddedShaders[];
+
+// Returns the embedded shader with the filename of the specified path, or null if no such shader was embedded.
+const EmbeddedShader* FindEmbeddedShader(const char* path);
+
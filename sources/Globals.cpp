@@ -12,6 +12,7 @@
 LLGL::RenderSystemPtr   renderer;
 LLGL::CommandBuffer*    cmdBuffer;
 Scene                   scene;
+Options                 options;
 bool                    quitDemo = false;
 
 
@@ -60,3 +61,20 @@ void ModelRotation(View& view, float x, float y, float z, float angle)
     m[1][2] = y*z*cc + x*s;
     m[2][2] = z*z*cc + c;
 }
+
+void MultiplyMatrices(float (&outMatrix)[4][4], const float (&lhs)[4][4], const float (&rhs)[4][4])
+{
+    for (int col = 0; col < 4; ++col)
+    {
+        for (int row = 0; row < 4; ++row)
+        {
+            outMatrix[col][row] =
+            (
+                lhs[0][row]*rhs[col][0] +
+                lhs[1][row]*rhs[col][1] +
+                lhs[2][row]*rhs[col][2] +
+                lhs[3][row]*rhs[col][3]
+            );
+        }
+    }
+}
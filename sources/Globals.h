@@ -9,6 +9,12 @@
 #pragma once
 
 #include <LLGL/LLGL.h>
+#include "DynamicResolution.h"
+#include "MeshOptimizer.h"
+#include "MeshSimplifier.h"
+#include "ObjectStore.h"
+#include "PresentScheduler.h"
+#include "Simulation.h"
 #include <memory>
 #include <cstdint>
 #include <cmath>
@@ -24,13 +30,72 @@
 #endif
 
 
+enum class PresentMode
+{
+    Fifo,       // Wait for vertical blank
+    Immediate,  // Present without waiting; may tear. There is no mailbox mode, since LLGL only exposes a vsync interval
+};
+
+struct Options
+{
+    const char*             moduleName      = nullptr;  // Name of the LLGL module to load; null for the platform default
+    std::uint64_t           numFrames       = 0;        // Number of frames to render before quitting; zero for no limit
+    std::uint32_t           numSwapBuffers  = 2;        // Number of swap-chain images per window
+    PresentMode             presentMode     = PresentMode::Immediate;
+    PresentPolicy           presentPolicy   = PresentPolicy::PrimaryVsync;  // How the swap chains of multiple windows share vertical blank
+    bool                    renderThread    = true;     // Record and present frames on a separate thread if the backend supports it
+    float                   simulationRate  = 60.0f;    // Fixed-timestep simulation steps per second
+    bool                    simulationThread = false;   // Run the fixed-timestep simulation on a separate thread
+    bool                    shadowGLState   = true;     // Render ImGui with GL state shadowing instead of the query based backup in the OpenGL backend
+    const char*             metricsShmName  = nullptr;  // Name of the shared-memory object for per-frame metrics; null to disable
+    const char*             metricsSocket   = nullptr;  // Path of the Unix-domain socket serving metrics in Prometheus text format; null to disable
+    const char*             shaderDir       = nullptr;  // Directory with a shader folder per backend, e.g. "sources/Backend"; null to use the embedded shaders
+    bool                    imGuiViewports  = false;    // Let ImGui windows move out of their main window into platform windows; requires the docking branch of ImGui
+    bool                    asyncLog        = true;     // Write log messages from a background thread instead of the reporting thread
+    bool                    debuggerCommandStats = false;   // Take command statistics from the rendering debugger of LLGL; only available in debug builds
+};
+
 struct Scene
 {
     LLGL::PipelineState*    graphicsPSO     = nullptr;
-    LLGL::Buffer*           viewCbuffer     = nullptr;
+    LLGL::PipelineLayout*   pipelineLayout  = nullptr;
+    LLGL::Buffer*           constantBuffer  = nullptr;      // View blocks of all windows followed by one Object block per object
+    LLGL::ResourceHeap*     constantHeap    = nullptr;      // One descriptor set per window and object
+    std::vector<char>       constantBlocks;                 // CPU copy of 'constantBuffer'; uploaded once per frame
+    std::uint32_t           objectCapacity  = 0;            // Number of Object blocks in 'constantBuffer'
+    bool                    areObjectBlocksDirty = false;   // Object blocks changed since the last upload
     LLGL::Buffer*           vertexBuffer    = nullptr;
     LLGL::Buffer*           indexBuffer     = nullptr;
+    std::uint32_t           numVertices     = 0;
     std::uint32_t           numIndices      = 0;
+    MeshDescriptor          meshDesc;                       // Descriptor of the current mesh
+    MeshDescriptor          nextMeshDesc;                   // Descriptor edited in the UI; applied between frames
+    bool                    isMeshDirty     = false;
+    float                   meshGenerationTime = 0.0f;      // CPU time in seconds to generate the current mesh
+    bool                    optimizeMesh    = false;        // Run vertex cache, overdraw and vertex fetch optimization after generation; blocks the main thread
+    bool                    buildMeshlets   = false;
+    MeshOptimizerStats      meshStats;
+    MeshletBuffer           meshlets;                       // CPU side meshlets of the current mesh if 'buildMeshlets' is enabled
+    bool                    generateLods    = false;        // Append simplified LODs of the mesh to 'indexBuffer'; blocks the main thread
+    std::vector<MeshLod>    meshLods;                       // Index ranges of all LODs in 'indexBuffer'; the first one is the full mesh
+    float                   lodGenerationTime = 0.0f;       // CPU time in seconds to build the LODs of the current mesh
+    float                   lodPixelError   = 1.0f;         // Maximum projected error in pixels of the selected LODs
+    float                   lodHysteresis   = 0.25f;        // Relative band around 'lodPixelError' in which objects keep their LOD
+    AABB                    meshBounds;                     // Local bounds of the current mesh
+    ObjectStore             objects;
+    BVH4                    objectBVH;                      // Shared by all windows for frustum culling
+    std::uint32_t           nextNumObjects  = 1;            // Number of objects edited in the UI; applied between frames
+    bool                    areObjectsDirty = false;
+    bool                    animateObjects  = false;
+    Simulation              simulation;                     // Fixed-timestep rotations of objects and windows
+    bool                    useFixedTimestep = true;        // Interpolate rotations from 'simulation' instead of integrating them per frame
+    float                   refitTime       = 0.0f;         // CPU time in seconds to refit the BVH in the last frame
+    float                   updateTime      = 0.0f;         // CPU time in seconds for the whole scene update job graph in the last frame
+    LLGL::PipelineState*    upscalePSO      = nullptr;      // Draws a scene target into the swap chain; null if dynamic resolution is not available
+    LLGL::PipelineLayout*   upscaleLayout   = nullptr;
+    LLGL::Sampler*          upscaleSampler  = nullptr;
+    DynamicResolution       dynamicResolution;
+    bool                    useDynamicResolution = false;
 };
 
 struct alignas(16) View
@@ -47,13 +112,21 @@ struct alignas(16) View
     float lightVector[4]    = { 0.0f, 0.0f, 1.0f, 0.0f };
 };
 
+struct alignas(16) Object
+{
+    float objectMatrix[4][4];
+    float objectColor[4];
+};
+
 
 extern LLGL::RenderSystemPtr    renderer;
 extern LLGL::CommandBuffer*     cmdBuffer;
 extern Scene                    scene;
+extern Options                  options;
 extern bool                     quitDemo;
 
 
 void ViewProjection(View& view, float aspectRatio = 1.0f, float nearPlane = 0.1f, float farPlane = 100.0f, float fov = 45.0f);
 void ModelRotation(View& view, float x, float y, float z, float angle);
+void MultiplyMatrices(float (&outMatrix)[4][4], const float (&lhs)[4][4], const float (&rhs)[4][4]);
 
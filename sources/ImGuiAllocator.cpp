@@ -0,0 +1,219 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * ImGuiAllocator.cpp
+ */
+
+#include "ImGuiAllocator.h"
+#include "MemoryTracker.h"
+#include "imgui.h"
+#include <LLGL/Log.h>
+#include <algorithm>
+#include <cstdlib>
+
+
+enum BlockKind : std::uint16_t
+{
+    BlockKindPool = 0,
+    BlockKindLarge,
+};
+
+// Every block is prefixed with this header so it can be freed without knowing the current ImGui context.
+struct alignas(16) BlockHeader
+{
+    void*           owner;          // ImGuiAllocator, or null for blocks allocated while no allocator was current
+    std::uint32_t   size;           // Size requested by ImGui, excluding this header
+    std::uint16_t   kind;
+    std::int16_t    windowIndex;
+};
+
+static_assert(sizeof(BlockHeader) == 16, "BlockHeader must preserve 16 byte alignment");
+
+// Block sizes including the header; all multiples of 16 to keep the payload aligned
+static const std::size_t g_sizeClassBlockSizes[ImGuiAllocator::numSizeClasses] =
+{
+    32, 48, 64, 96, 128, 192, 256, 384, 512, 768, 1024, 1536, 2048, 3072, 4096, 6144, 8192 + 16
+};
+
+static thread_local ImGuiAllocator* g_pendingAllocator = nullptr;
+
+static int FindSizeClass(std::size_t size)
+{
+    const std::size_t blockSize = size + sizeof(BlockHeader);
+    for (int i = 0; i < ImGuiAllocator::numSizeClasses; ++i)
+    {
+        if (blockSize <= g_sizeClassBlockSizes[i])
+            return i;
+    }
+    return -1;
+}
+
+static void* WriteBlockHeader(void* block, void* owner, std::size_t size, BlockKind kind, int windowIndex)
+{
+    BlockHeader* header = static_cast<BlockHeader*>(block);
+    {
+        header->owner       = owner;
+        header->size        = static_cast<std::uint32_t>(size);
+        header->kind        = kind;
+        header->windowIndex = static_cast<std::int16_t>(windowIndex);
+    }
+    MemoryTracker::AddHeapAllocation(MemoryCategory::ImGuiHeap, windowIndex, size);
+    return header + 1;
+}
+
+// Fallback for allocations while no context with an allocator is current
+static void* AllocUnowned(std::size_t size)
+{
+    void* block = std::malloc(sizeof(BlockHeader) + size);
+    if (block == nullptr)
+        return nullptr;
+    return WriteBlockHeader(block, nullptr, size, BlockKindLarge, -1);
+}
+
+static void* ImGuiAllocFunc(std::size_t size, void* /*userData*/)
+{
+    ImGuiAllocator* allocator = g_pendingAllocator;
+    if (allocator == nullptr && ImGui::GetCurrentContext() != nullptr)
+        allocator = static_cast<ImGuiAllocator*>(ImGui::GetIO().UserData);
+
+    if (allocator != nullptr)
+        return allocator->Alloc(size);
+    else
+        return AllocUnowned(size);
+}
+
+static void ImGuiFreeFunc(void* ptr, void* /*userData*/)
+{
+    ImGuiAllocator::Free(ptr);
+}
+
+
+/*
+ * ImGuiAllocator class
+ */
+
+ImGuiAllocator::ImGuiAllocator(int windowIndex) :
+    windowIndex { windowIndex }
+{
+}
+
+ImGuiAllocator::~ImGuiAllocator()
+{
+    const std::uint64_t numLiveBlocks = stats.numAllocs - stats.numFrees;
+    if (numLiveBlocks > 0)
+        LLGL::Log::Errorf("ImGui allocator of window %d released with %u live block(s)\n", windowIndex, static_cast<unsigned>(numLiveBlocks));
+
+    for (void* page : poolPages)
+        std::free(page);
+}
+
+void* ImGuiAllocator::Alloc(std::size_t size)
+{
+    ++stats.numAllocs;
+
+    const int sizeClass = FindSizeClass(size);
+    if (sizeClass >= 0)
+        return AllocFromPool(sizeClass, size);
+    else
+        return AllocLarge(size);
+}
+
+void ImGuiAllocator::Free(void* ptr)
+{
+    if (ptr == nullptr)
+        return;
+
+    BlockHeader* header = static_cast<BlockHeader*>(ptr) - 1;
+    MemoryTracker::RemoveHeapAllocation(MemoryCategory::ImGuiHeap, header->windowIndex, header->size);
+
+    switch (header->kind)
+    {
+        case BlockKindPool:
+        {
+            ImGuiAllocator* owner = static_cast<ImGuiAllocator*>(header->owner);
+            owner->FreeToPool(header, FindSizeClass(header->size));
+        }
+        break;
+
+        case BlockKindLarge:
+        {
+            if (ImGuiAllocator* owner = static_cast<ImGuiAllocator*>(header->owner))
+                ++owner->stats.numFrees;
+            std::free(header);
+        }
+        break;
+    }
+}
+
+void ImGuiAllocator::NextFrame()
+{
+    // Publish statistics of the completed frame
+    stats.frameAllocs   = stats.numAllocs - frameAllocsBegin;
+    stats.frameFrees    = stats.numFrees - frameFreesBegin;
+    frameAllocsBegin    = stats.numAllocs;
+    frameFreesBegin     = stats.numFrees;
+}
+
+void ImGuiAllocator::Install()
+{
+    ImGui::SetAllocatorFunctions(ImGuiAllocFunc, ImGuiFreeFunc, nullptr);
+}
+
+void ImGuiAllocator::SetPending(ImGuiAllocator* allocator)
+{
+    g_pendingAllocator = allocator;
+}
+
+void* ImGuiAllocator::AllocFromPool(int sizeClass, std::size_t size)
+{
+    ++stats.numPoolAllocs;
+
+    if (freeLists[sizeClass] == nullptr)
+    {
+        // Carve a new page into blocks of this size class; pages of the largest classes hold at least four blocks
+        const std::size_t blockSize = g_sizeClassBlockSizes[sizeClass];
+        const std::size_t pageSize  = std::max(poolPageSize, blockSize * 4);
+
+        char* page = static_cast<char*>(std::malloc(pageSize));
+        if (page == nullptr)
+            return nullptr;
+
+        poolPages.push_back(page);
+        stats.reservedBytes += pageSize;
+
+        for (std::size_t offset = 0; offset + blockSize <= pageSize; offset += blockSize)
+        {
+            FreeBlock* block = reinterpret_cast<FreeBlock*>(page + offset);
+            block->next = freeLists[sizeClass];
+            freeLists[sizeClass] = block;
+        }
+    }
+
+    FreeBlock* block = freeLists[sizeClass];
+    freeLists[sizeClass] = block->next;
+
+    return WriteBlockHeader(block, this, size, BlockKindPool, windowIndex);
+}
+
+void* ImGuiAllocator::AllocLarge(std::size_t size)
+{
+    ++stats.numLargeAllocs;
+
+    void* block = std::malloc(sizeof(BlockHeader) + size);
+    if (block == nullptr)
+        return nullptr;
+
+    return WriteBlockHeader(block, this, size, BlockKindLarge, windowIndex);
+}
+
+void ImGuiAllocator::FreeToPool(void* block, int sizeClass)
+{
+    ++stats.numFrees;
+
+    FreeBlock* freeBlock = static_cast<FreeBlock*>(block);
+    freeBlock->next = freeLists[sizeClass];
+    freeLists[sizeClass] = freeBlock;
+}
+
@@ -0,0 +1,90 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * ImGuiAllocator.h
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+// Allocator for a single ImGui context with size-class pools for blocks up to 8 KiB and malloc for larger blocks.
+// No locks are taken, so each allocator is owned by a single thread: only that thread allocates from it and calls NextFrame().
+// Blocks are returned to the allocator they came from, so they must be freed by its owning thread or while that thread is idle.
+// A context that is also used by a second thread, e.g. a render thread, routes the allocations of that thread to a
+// separate allocator with SetPending().
+class ImGuiAllocator
+{
+public:
+    static constexpr int            numSizeClasses  = 17;
+    static constexpr std::size_t    poolPageSize    = 16*1024;
+
+    struct Statistics
+    {
+        std::uint64_t   numAllocs           = 0;
+        std::uint64_t   numFrees            = 0;
+        std::uint64_t   numPoolAllocs       = 0;
+        std::uint64_t   numLargeAllocs      = 0;
+        std::uint64_t   frameAllocs         = 0;    // Allocations during the last completed frame
+        std::uint64_t   frameFrees          = 0;    // Deallocations during the last completed frame
+        std::uint64_t   reservedBytes       = 0;    // Bytes reserved for pool pages
+    };
+
+public:
+    explicit ImGuiAllocator(int windowIndex);
+    ~ImGuiAllocator();
+
+    ImGuiAllocator(const ImGuiAllocator&) = delete;
+    ImGuiAllocator& operator = (const ImGuiAllocator&) = delete;
+
+    void* Alloc(std::size_t size);
+
+    // Returns the block to the allocator that owns it, regardless of which ImGui context is current.
+    static void Free(void* ptr);
+
+    // Publishes the statistics of the completed frame.
+    void NextFrame();
+
+    // Installs the allocator functions for all ImGui contexts. Allocations are routed to the allocator in ImGuiIO::UserData.
+    static void Install();
+
+    // Routes allocations of the calling thread to this allocator instead of the one of the current context, e.g. during
+    // ImGui::CreateContext() or on a thread that does not own the allocator of the context. Reset with null afterwards.
+    static void SetPending(ImGuiAllocator* allocator);
+
+    const Statistics& GetStatistics() const
+    {
+        return stats;
+    }
+
+    int GetWindowIndex() const
+    {
+        return windowIndex;
+    }
+
+private:
+    struct FreeBlock
+    {
+        FreeBlock* next;
+    };
+
+private:
+    void* AllocFromPool(int sizeClass, std::size_t size);
+    void* AllocLarge(std::size_t size);
+
+    void FreeToPool(void* block, int sizeClass);
+
+private:
+    int                         windowIndex                 = -1;
+    FreeBlock*                  freeLists[numSizeClasses]   = {};
+    std::vector<void*>          poolPages;
+    Statistics                  stats;
+    std::uint64_t               frameAllocsBegin            = 0;
+    std::uint64_t               frameFreesBegin             = 0;
+};
+
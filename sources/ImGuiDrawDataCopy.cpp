@@ -0,0 +1,77 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * ImGuiDrawDataCopy.cpp
+ */
+
+#include "ImGuiDrawDataCopy.h"
+#include <cstring>
+
+
+// Copies the elements without releasing the destination buffer first, unlike the assignment operator of ImVector
+template <typename T>
+static void CopyVector(ImVector<T>& dst, const ImVector<T>& src)
+{
+    dst.resize(src.Size);
+    if (src.Size > 0)
+        std::memcpy(dst.Data, src.Data, static_cast<std::size_t>(src.Size) * sizeof(T));
+}
+
+ImGuiDrawDataCopy::~ImGuiDrawDataCopy()
+{
+    for (ImDrawList* drawList : drawLists)
+        IM_DELETE(drawList);
+}
+
+void ImGuiDrawDataCopy::CopyFrom(const ImDrawData* data)
+{
+    // Only the output of the draw lists is copied; renderer backends never read their internal build state
+    while (drawLists.Size < data->CmdListsCount)
+        drawLists.push_back(IM_NEW(ImDrawList)(ImGui::GetDrawListSharedData()));
+
+    drawData.CmdLists.resize(data->CmdListsCount);
+    for (int i = 0; i < data->CmdListsCount; ++i)
+    {
+        const ImDrawList* srcList = data->CmdLists[i];
+        ImDrawList* dstList = drawLists[i];
+        CopyVector(dstList->CmdBuffer, srcList->CmdBuffer);
+        CopyVector(dstList->IdxBuffer, srcList->IdxBuffer);
+        CopyVector(dstList->VtxBuffer, srcList->VtxBuffer);
+        dstList->Flags = srcList->Flags;
+        drawData.CmdLists[i] = dstList;
+    }
+
+    drawData.Valid              = data->Valid;
+    drawData.CmdListsCount      = data->CmdListsCount;
+    drawData.TotalIdxCount      = data->TotalIdxCount;
+    drawData.TotalVtxCount      = data->TotalVtxCount;
+    drawData.DisplayPos         = data->DisplayPos;
+    drawData.DisplaySize        = data->DisplaySize;
+    drawData.FramebufferScale   = data->FramebufferScale;
+    drawData.OwnerViewport      = data->OwnerViewport;
+
+    #if IMGUI_VERSION_NUM >= 19200
+    textures.resize(0);
+    if (data->Textures != nullptr)
+    {
+        for (ImTextureData* texture : *data->Textures)
+        {
+            if (texture->Status != ImTextureStatus_OK)
+                textures.push_back(texture);
+        }
+    }
+    drawData.Textures = &textures;
+    #endif
+}
+
+bool ImGuiDrawDataCopy::HasTextureUpdates() const
+{
+    #if IMGUI_VERSION_NUM >= 19200
+    return !textures.empty();
+    #else
+    return false;
+    #endif
+}
+
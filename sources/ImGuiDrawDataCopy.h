@@ -0,0 +1,45 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * ImGuiDrawDataCopy.h
+ */
+
+#pragma once
+
+#include "imgui.h"
+
+
+// Deep copy of the draw data of an ImGui context, so it can be rendered on another thread while the context
+// already builds the next frame. The draw lists are reused across frames and only grow, so copying rarely allocates.
+// Copies must be made and destroyed on the thread that owns the ImGui context, since they use its allocator.
+class ImGuiDrawDataCopy
+{
+public:
+    ImGuiDrawDataCopy() = default;
+    ~ImGuiDrawDataCopy();
+
+    ImGuiDrawDataCopy(const ImGuiDrawDataCopy&) = delete;
+    ImGuiDrawDataCopy& operator = (const ImGuiDrawDataCopy&) = delete;
+
+    // Copies vertices, indices, and commands of all draw lists; must be called after ImGui::Render() with the source context being current.
+    void CopyFrom(const ImDrawData* data);
+
+    // Returns true if the last copy includes textures the renderer backend must create, update, or destroy.
+    // The backend modifies those textures while rendering, so the source context must not build a new frame until then.
+    bool HasTextureUpdates() const;
+
+    ImDrawData* GetDrawData()
+    {
+        return &drawData;
+    }
+
+private:
+    ImDrawData                  drawData;
+    ImVector<ImDrawList*>       drawLists;      // All draw lists ever copied into; only the first 'drawData.CmdListsCount' are valid
+    #if IMGUI_VERSION_NUM >= 19200
+    ImVector<ImTextureData*>    textures;       // Textures with pending requests; the others are hidden from the renderer backend
+    #endif
+};
+
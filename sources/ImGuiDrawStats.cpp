@@ -0,0 +1,221 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * ImGuiDrawStats.cpp
+ */
+
+#include "ImGuiDrawStats.h"
+#include <algorithm>
+
+
+static const ImVec4 g_overBudgetColor = ImVec4{ 1.0f, 0.4f, 0.4f, 1.0f };
+
+static bool IsEqualClipRect(const ImVec4& lhs, const ImVec4& rhs)
+{
+    return (lhs.x == rhs.x && lhs.y == rhs.y && lhs.z == rhs.z && lhs.w == rhs.w);
+}
+
+void ImGuiDrawStats::BeginWidget(const char* name)
+{
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+
+    OpenWidget widget;
+    {
+        widget.name         = name;
+        widget.drawList     = drawList;
+        widget.vertexStart  = drawList->VtxBuffer.Size;
+        widget.indexStart   = drawList->IdxBuffer.Size;
+        widget.drawCmdStart = drawList->CmdBuffer.Size;
+    }
+    openWidgets.push_back(widget);
+}
+
+void ImGuiDrawStats::EndWidget()
+{
+    if (openWidgets.empty())
+        return;
+
+    const OpenWidget& widget = openWidgets.back();
+    const ImDrawList* drawList = widget.drawList;
+
+    WidgetStats stats;
+    {
+        stats.name          = widget.name;
+        stats.windowName    = (drawList->_OwnerName != nullptr ? drawList->_OwnerName : "");
+        stats.numVertices   = static_cast<std::uint32_t>(std::max(0, drawList->VtxBuffer.Size - widget.vertexStart));
+        stats.numIndices    = static_cast<std::uint32_t>(std::max(0, drawList->IdxBuffer.Size - widget.indexStart));
+        stats.numDrawCmds   = static_cast<std::uint32_t>(std::max(0, drawList->CmdBuffer.Size - widget.drawCmdStart));
+    }
+    frameWidgets.push_back(stats);
+
+    openWidgets.pop_back();
+}
+
+void ImGuiDrawStats::CollectDrawData(const ImDrawData* data)
+{
+    openWidgets.clear();
+    widgets.swap(frameWidgets);
+    frameWidgets.clear();
+
+    drawLists.clear();
+    totalVertices   = 0;
+    totalIndices    = 0;
+    totalDrawCmds   = 0;
+
+    if (data == nullptr)
+        return;
+
+    for (const ImDrawList* drawList : data->CmdLists)
+    {
+        DrawListStats stats;
+        {
+            stats.name          = (drawList->_OwnerName != nullptr ? drawList->_OwnerName : "");
+            stats.numVertices   = static_cast<std::uint32_t>(drawList->VtxBuffer.Size);
+            stats.numIndices    = static_cast<std::uint32_t>(drawList->IdxBuffer.Size);
+        }
+
+        const ImDrawCmd* prevCmd = nullptr;
+        for (const ImDrawCmd& cmd : drawList->CmdBuffer)
+        {
+            // Callbacks don't draw anything and may reset any state
+            if (cmd.UserCallback != nullptr)
+            {
+                prevCmd = nullptr;
+                continue;
+            }
+
+            ++stats.numDrawCmds;
+            if (prevCmd == nullptr || prevCmd->GetTexID() != cmd.GetTexID())
+                ++stats.numTextureSwitches;
+            if (prevCmd == nullptr || !IsEqualClipRect(prevCmd->ClipRect, cmd.ClipRect))
+                ++stats.numClipRectChanges;
+
+            prevCmd = &cmd;
+        }
+
+        totalVertices   += stats.numVertices;
+        totalIndices    += stats.numIndices;
+        totalDrawCmds   += stats.numDrawCmds;
+
+        drawLists.push_back(stats);
+    }
+
+    // Show the most expensive draw lists and widgets first
+    std::sort(
+        drawLists.begin(), drawLists.end(),
+        [](const DrawListStats& lhs, const DrawListStats& rhs) { return (lhs.numVertices > rhs.numVertices); }
+    );
+    std::sort(
+        widgets.begin(), widgets.end(),
+        [](const WidgetStats& lhs, const WidgetStats& rhs) { return (lhs.numVertices > rhs.numVertices); }
+    );
+}
+
+std::uint32_t ImGuiDrawStats::GetNumOverBudget() const
+{
+    std::uint32_t numOverBudget = 0;
+
+    for (const DrawListStats& stats : drawLists)
+    {
+        if (stats.numVertices > static_cast<std::uint32_t>(budget.maxVerticesPerWindow) ||
+            stats.numDrawCmds > static_cast<std::uint32_t>(budget.maxDrawCmdsPerWindow))
+        {
+            ++numOverBudget;
+        }
+    }
+
+    for (const WidgetStats& stats : widgets)
+    {
+        if (stats.numVertices > static_cast<std::uint32_t>(budget.maxVerticesPerWidget))
+            ++numOverBudget;
+    }
+
+    return numOverBudget;
+}
+
+// Shows the value in the current table cell and highlights it if it exceeds the limit
+static void TableCellWithLimit(std::uint32_t value, int limit)
+{
+    ImGui::TableNextColumn();
+    if (value > static_cast<std::uint32_t>(limit))
+        ImGui::TextColored(g_overBudgetColor, "%u", value);
+    else
+        ImGui::Text("%u", value);
+}
+
+void ImGuiDrawStats::ShowPanel(bool* isOpen)
+{
+    ImGui::SetNextWindowSize(ImVec2{ 480.0f, 420.0f }, ImGuiCond_FirstUseEver);
+    if (ImGui::Begin("ImGui Draw Statistics", isOpen))
+    {
+        ImGui::SeparatorText("Budget");
+        {
+            ImGui::SliderInt("Vertices/Window", &budget.maxVerticesPerWindow, 1000, 100000, "%d", ImGuiSliderFlags_Logarithmic);
+            ImGui::SliderInt("Vertices/Widget", &budget.maxVerticesPerWidget, 100, 50000, "%d", ImGuiSliderFlags_Logarithmic);
+            ImGui::SliderInt("Draws/Window", &budget.maxDrawCmdsPerWindow, 1, 1024, "%d", ImGuiSliderFlags_Logarithmic);
+            ImGui::SliderInt("Vertices Total", &budget.maxVerticesTotal, 1000, 500000, "%d", ImGuiSliderFlags_Logarithmic);
+
+            if (totalVertices > static_cast<std::uint32_t>(budget.maxVerticesTotal))
+                ImGui::TextColored(g_overBudgetColor, "Total: %u vertices, %u indices, %u draws (over budget)", totalVertices, totalIndices, totalDrawCmds);
+            else
+                ImGui::Text("Total: %u vertices, %u indices, %u draws", totalVertices, totalIndices, totalDrawCmds);
+
+            if (const std::uint32_t numOverBudget = GetNumOverBudget())
+                ImGui::TextColored(g_overBudgetColor, "%u windows or widgets over budget", numOverBudget);
+        }
+        ImGui::SeparatorText("Windows");
+        {
+            if (ImGui::BeginTable("DrawListStats", 6, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit))
+            {
+                ImGui::TableSetupColumn("Window", ImGuiTableColumnFlags_WidthStretch);
+                ImGui::TableSetupColumn("Vertices");
+                ImGui::TableSetupColumn("Indices");
+                ImGui::TableSetupColumn("Draws");
+                ImGui::TableSetupColumn("Textures");
+                ImGui::TableSetupColumn("Clip Rects");
+                ImGui::TableHeadersRow();
+
+                for (const DrawListStats& stats : drawLists)
+                {
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn(); ImGui::TextUnformatted(stats.name.c_str());
+                    TableCellWithLimit(stats.numVertices, budget.maxVerticesPerWindow);
+                    ImGui::TableNextColumn(); ImGui::Text("%u", stats.numIndices);
+                    TableCellWithLimit(stats.numDrawCmds, budget.maxDrawCmdsPerWindow);
+                    ImGui::TableNextColumn(); ImGui::Text("%u", stats.numTextureSwitches);
+                    ImGui::TableNextColumn(); ImGui::Text("%u", stats.numClipRectChanges);
+                }
+
+                ImGui::EndTable();
+            }
+        }
+        ImGui::SeparatorText("Widgets");
+        {
+            if (ImGui::BeginTable("WidgetStats", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit))
+            {
+                ImGui::TableSetupColumn("Widget", ImGuiTableColumnFlags_WidthStretch);
+                ImGui::TableSetupColumn("Window");
+                ImGui::TableSetupColumn("Vertices");
+                ImGui::TableSetupColumn("Indices");
+                ImGui::TableSetupColumn("Draws");
+                ImGui::TableHeadersRow();
+
+                for (const WidgetStats& stats : widgets)
+                {
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn(); ImGui::TextUnformatted(stats.name.c_str());
+                    ImGui::TableNextColumn(); ImGui::TextUnformatted(stats.windowName.c_str());
+                    TableCellWithLimit(stats.numVertices, budget.maxVerticesPerWidget);
+                    ImGui::TableNextColumn(); ImGui::Text("%u", stats.numIndices);
+                    ImGui::TableNextColumn(); ImGui::Text("%u", stats.numDrawCmds);
+                }
+
+                ImGui::EndTable();
+            }
+        }
+    }
+    ImGui::End();
+}
+
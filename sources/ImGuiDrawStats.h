@@ -0,0 +1,86 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * ImGuiDrawStats.h
+ */
+
+#pragma once
+
+#include "imgui.h"
+#include <string>
+#include <vector>
+#include <cstdint>
+
+
+// Draw-list statistics of a single ImGui context, collected per ImGui window and per measured widget.
+// Statistics are shown one frame late, since draw lists are only complete after ImGui::Render().
+class ImGuiDrawStats
+{
+public:
+    struct DrawListStats
+    {
+        std::string     name;                       // Name of the ImGui window that owns the draw list
+        std::uint32_t   numVertices         = 0;
+        std::uint32_t   numIndices          = 0;
+        std::uint32_t   numDrawCmds         = 0;
+        std::uint32_t   numTextureSwitches  = 0;    // Draw commands that bind a different texture than their predecessor
+        std::uint32_t   numClipRectChanges  = 0;    // Draw commands that set a different scissor rectangle than their predecessor
+    };
+
+    struct WidgetStats
+    {
+        std::string     name;
+        std::string     windowName;
+        std::uint32_t   numVertices         = 0;
+        std::uint32_t   numIndices          = 0;
+        std::uint32_t   numDrawCmds         = 0;
+    };
+
+    struct Budget
+    {
+        int             maxVerticesPerWindow    = 20000;
+        int             maxVerticesPerWidget    = 5000;
+        int             maxDrawCmdsPerWindow    = 64;
+        int             maxVerticesTotal        = 50000;
+    };
+
+public:
+    // Attributes all vertices that are added to the current window between BeginWidget() and EndWidget() to the named widget.
+    // Widgets inside tables or columns are only approximated, since those split the draw list into channels.
+    void BeginWidget(const char* name);
+    void EndWidget();
+
+    // Collects the statistics of all draw lists; must be called after ImGui::Render().
+    void CollectDrawData(const ImDrawData* data);
+
+    // Shows the statistics of the last frame in a separate ImGui window with editable budgets.
+    void ShowPanel(bool* isOpen);
+
+    // Returns the number of windows and widgets that exceeded their budget in the last frame.
+    std::uint32_t GetNumOverBudget() const;
+
+public:
+    Budget  budget;
+
+private:
+    struct OpenWidget
+    {
+        const char*     name;
+        ImDrawList*     drawList;
+        int             vertexStart;
+        int             indexStart;
+        int             drawCmdStart;
+    };
+
+private:
+    std::vector<OpenWidget>     openWidgets;
+    std::vector<WidgetStats>    frameWidgets;   // Widgets measured during the current frame
+    std::vector<WidgetStats>    widgets;        // Widgets of the last collected frame
+    std::vector<DrawListStats>  drawLists;      // Draw lists of the last collected frame
+    std::uint32_t               totalVertices   = 0;
+    std::uint32_t               totalIndices    = 0;
+    std::uint32_t               totalDrawCmds   = 0;
+};
+
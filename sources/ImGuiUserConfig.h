@@ -0,0 +1,17 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * ImGuiUserConfig.h
+ */
+
+#pragma once
+
+
+// Make the current ImGui context thread-local, so the render thread can render the draw data of one context
+// while the main thread builds the next frame of another. The variable is defined in Backend.cpp.
+struct ImGuiContext;
+extern thread_local ImGuiContext* g_imGuiThreadContext;
+#define GImGui g_imGuiThreadContext
+
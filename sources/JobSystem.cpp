@@ -0,0 +1,233 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * JobSystem.cpp
+ */
+
+#include "JobSystem.h"
+#include <algorithm>
+
+
+// Index of the worker queue owned by the calling thread; threads that are not workers share the last queue
+static thread_local int g_workerQueueIndex = -1;
+
+// Number of failed attempts to find a job before a worker goes to sleep
+static constexpr int g_spinCount = 64;
+
+JobSystem& JobSystem::Get()
+{
+    static JobSystem instance;
+    return instance;
+}
+
+JobSystem::JobSystem()
+{
+    // Keep one hardware thread for the main thread, which participates in Wait()
+    const std::uint32_t numWorkers = std::max(1u, std::thread::hardware_concurrency()) - 1;
+
+    for (std::uint32_t i = 0; i <= numWorkers; ++i)
+        queues.emplace_back(new WorkerQueue{});
+
+    workers.reserve(numWorkers);
+    for (std::uint32_t i = 0; i < numWorkers; ++i)
+        workers.emplace_back(&JobSystem::WorkerMain, this, i);
+}
+
+JobSystem::~JobSystem()
+{
+    {
+        std::lock_guard<std::mutex> guard{ sleepMutex };
+        isQuitting = true;
+    }
+    sleepCondition.notify_all();
+
+    for (std::thread& worker : workers)
+        worker.join();
+}
+
+void JobSystem::Run(std::function<void()> job, JobCounter* counter)
+{
+    if (counter != nullptr)
+        counter->pending.fetch_add(1, std::memory_order_relaxed);
+    Push(Job{ std::move(job), counter });
+}
+
+void JobSystem::RunAfter(JobCounter& dependency, std::function<void()> job, JobCounter* counter)
+{
+    if (counter != nullptr)
+        counter->pending.fetch_add(1, std::memory_order_relaxed);
+
+    {
+        std::lock_guard<std::mutex> guard{ dependency.continuationMutex };
+        if (!dependency.IsDone())
+        {
+            dependency.continuations.push_back(JobCounter::Continuation{ std::move(job), counter });
+            return;
+        }
+    }
+
+    Push(Job{ std::move(job), counter });
+}
+
+void JobSystem::ParallelFor(std::uint32_t count, std::uint32_t grainSize, const ParallelForFunc& func, JobCounter* counter)
+{
+    grainSize = std::max(1u, grainSize);
+    for (std::uint32_t begin = 0; begin < count; begin += grainSize)
+    {
+        const std::uint32_t end = std::min(count, begin + grainSize);
+        Run([func, begin, end]() { func(begin, end); }, counter);
+    }
+}
+
+void JobSystem::ParallelFor(std::uint32_t count, std::uint32_t grainSize, const ParallelForFunc& func)
+{
+    if (count <= grainSize || workers.empty())
+    {
+        if (count > 0)
+            func(0, count);
+        return;
+    }
+
+    JobCounter counter;
+    ParallelFor(count, grainSize, func, &counter);
+    Wait(counter);
+}
+
+void JobSystem::Wait(JobCounter& counter)
+{
+    const std::uint32_t queueIndex = (g_workerQueueIndex >= 0 ? static_cast<std::uint32_t>(g_workerQueueIndex) : static_cast<std::uint32_t>(queues.size() - 1));
+    while (!counter.IsDone())
+    {
+        if (!TryExecuteOne(queueIndex))
+            std::this_thread::yield();
+    }
+
+    // Wait until Finish() has released the counter, so it can be destroyed once this function returns
+    std::lock_guard<std::mutex> guard{ counter.continuationMutex };
+}
+
+void JobSystem::Push(Job&& job)
+{
+    const std::uint32_t queueIndex = (g_workerQueueIndex >= 0 ? static_cast<std::uint32_t>(g_workerQueueIndex) : static_cast<std::uint32_t>(queues.size() - 1));
+    {
+        WorkerQueue& queue = *queues[queueIndex];
+        std::lock_guard<std::mutex> guard{ queue.mutex };
+        queue.jobs.push_back(std::move(job));
+    }
+
+    numQueuedJobs.fetch_add(1, std::memory_order_release);
+
+    // Taking the sleep mutex avoids a lost wakeup between a worker's check and its wait
+    {
+        std::lock_guard<std::mutex> guard{ sleepMutex };
+    }
+    sleepCondition.notify_one();
+}
+
+bool JobSystem::Pop(std::uint32_t queueIndex, Job& outJob)
+{
+    WorkerQueue& queue = *queues[queueIndex];
+    std::lock_guard<std::mutex> guard{ queue.mutex };
+    if (queue.jobs.empty())
+        return false;
+
+    // Newest job first; it most likely works on data that is still in cache
+    outJob = std::move(queue.jobs.back());
+    queue.jobs.pop_back();
+    return true;
+}
+
+bool JobSystem::Steal(std::uint32_t thiefIndex, Job& outJob)
+{
+    const std::uint32_t numQueues = static_cast<std::uint32_t>(queues.size());
+    for (std::uint32_t i = 1; i < numQueues; ++i)
+    {
+        WorkerQueue& queue = *queues[(thiefIndex + i) % numQueues];
+        std::lock_guard<std::mutex> guard{ queue.mutex };
+        if (!queue.jobs.empty())
+        {
+            // Oldest job first; it is usually the largest remaining piece of work
+            outJob = std::move(queue.jobs.front());
+            queue.jobs.pop_front();
+            numSteals.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool JobSystem::TryExecuteOne(std::uint32_t queueIndex)
+{
+    Job job = {};
+    if (Pop(queueIndex, job) || Steal(queueIndex, job))
+    {
+        numQueuedJobs.fetch_sub(1, std::memory_order_relaxed);
+        Execute(job);
+        return true;
+    }
+    return false;
+}
+
+void JobSystem::Execute(Job& job)
+{
+    job.func();
+    if (job.counter != nullptr)
+        Finish(*job.counter);
+}
+
+void JobSystem::Finish(JobCounter& counter)
+{
+    // Lock-free decrement for all but the last pending job
+    std::uint32_t pending = counter.pending.load(std::memory_order_relaxed);
+    while (pending > 1)
+    {
+        if (counter.pending.compare_exchange_weak(pending, pending - 1, std::memory_order_acq_rel))
+            return;
+    }
+
+    // The last decrement happens under the lock, so RunAfter() and Wait() observe it together with the released continuations
+    std::vector<JobCounter::Continuation> continuations;
+    {
+        std::lock_guard<std::mutex> guard{ counter.continuationMutex };
+        if (counter.pending.fetch_sub(1, std::memory_order_acq_rel) != 1)
+            return;
+        continuations.swap(counter.continuations);
+    }
+
+    for (JobCounter::Continuation& continuation : continuations)
+        Push(Job{ std::move(continuation.job), continuation.counter });
+}
+
+void JobSystem::WorkerMain(std::uint32_t queueIndex)
+{
+    g_workerQueueIndex = static_cast<int>(queueIndex);
+
+    int numFailedAttempts = 0;
+    while (!isQuitting.load(std::memory_order_acquire))
+    {
+        if (TryExecuteOne(queueIndex))
+        {
+            numFailedAttempts = 0;
+            continue;
+        }
+
+        if (++numFailedAttempts < g_spinCount)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock{ sleepMutex };
+        sleepCondition.wait(
+            lock,
+            [this]() -> bool
+            {
+                return (isQuitting.load(std::memory_order_acquire) || numQueuedJobs.load(std::memory_order_acquire) > 0);
+            }
+        );
+        numFailedAttempts = 0;
+    }
+}
+
@@ -0,0 +1,124 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * JobSystem.h
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+class JobSystem;
+
+// Counts pending jobs. Jobs scheduled with RunAfter() are started once the counter drops to zero.
+// A counter must outlive its jobs, i.e. it may only be destroyed after JobSystem::Wait() returned for it.
+class JobCounter
+{
+public:
+    JobCounter() = default;
+
+    JobCounter(const JobCounter&) = delete;
+    JobCounter& operator = (const JobCounter&) = delete;
+
+    bool IsDone() const
+    {
+        return (pending.load(std::memory_order_acquire) == 0);
+    }
+
+private:
+    friend class JobSystem;
+
+    struct Continuation
+    {
+        std::function<void()>   job;
+        JobCounter*             counter;
+    };
+
+    std::atomic<std::uint32_t>  pending { 0 };
+    std::mutex                  continuationMutex;
+    std::vector<Continuation>   continuations;
+};
+
+// Work-stealing job scheduler. Each worker owns a deque: it pushes and pops jobs at the back and
+// idle workers steal from the front of other deques. Threads waiting for a counter execute jobs as well.
+class JobSystem
+{
+public:
+    using ParallelForFunc = std::function<void(std::uint32_t begin, std::uint32_t end)>;
+
+public:
+    static JobSystem& Get();
+
+    ~JobSystem();
+
+    // Schedules the job and increments the optional counter until the job has finished.
+    void Run(std::function<void()> job, JobCounter* counter = nullptr);
+
+    // Schedules the job once 'dependency' is done. The optional counter is incremented immediately.
+    void RunAfter(JobCounter& dependency, std::function<void()> job, JobCounter* counter = nullptr);
+
+    // Splits [0, count) into ranges of at most 'grainSize' elements and schedules one job per range.
+    void ParallelFor(std::uint32_t count, std::uint32_t grainSize, const ParallelForFunc& func, JobCounter* counter);
+
+    // Blocking version of ParallelFor(); runs inline if the range fits into a single grain.
+    void ParallelFor(std::uint32_t count, std::uint32_t grainSize, const ParallelForFunc& func);
+
+    // Executes pending jobs on the calling thread until the counter is done.
+    void Wait(JobCounter& counter);
+
+    std::uint32_t GetNumWorkers() const
+    {
+        return static_cast<std::uint32_t>(workers.size());
+    }
+
+    std::uint64_t GetNumSteals() const
+    {
+        return numSteals.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct Job
+    {
+        std::function<void()>   func;
+        JobCounter*             counter;
+    };
+
+    struct WorkerQueue
+    {
+        std::mutex          mutex;
+        std::deque<Job>     jobs;
+    };
+
+private:
+    JobSystem();
+
+    void Push(Job&& job);
+    bool Pop(std::uint32_t queueIndex, Job& outJob);
+    bool Steal(std::uint32_t thiefIndex, Job& outJob);
+    bool TryExecuteOne(std::uint32_t queueIndex);
+    void Execute(Job& job);
+    void Finish(JobCounter& counter);
+    void WorkerMain(std::uint32_t queueIndex);
+
+private:
+    std::vector<std::unique_ptr<WorkerQueue>>   queues;         // One per worker plus one shared by all other threads
+    std::vector<std::thread>                    workers;
+
+    std::mutex                                  sleepMutex;
+    std::condition_variable                     sleepCondition;
+    std::atomic<std::int32_t>                   numQueuedJobs   { 0 };  // May be briefly negative while a job is popped before its push is counted
+    std::atomic<std::uint64_t>                  numSteals       { 0 };
+    std::atomic<bool>                           isQuitting      { false };
+};
+
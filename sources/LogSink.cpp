@@ -0,0 +1,263 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * LogSink.cpp
+ */
+
+#include "LogSink.h"
+#include <LLGL/LLGL.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+#ifdef _WIN32
+#   include <io.h>
+#   define isatty _isatty
+#   define fileno _fileno
+#else
+#   include <unistd.h>
+#endif
+
+
+// Number of slots in the ring; must be a power of two
+static constexpr std::uint64_t g_numLogSlots = 1024;
+
+// A single message never takes more than this many slots, so a huge report cannot starve all other messages
+static constexpr std::uint64_t g_maxSlotsPerMessage = g_numLogSlots / 4;
+
+// Time in seconds within which a repeated message is suppressed
+static constexpr double g_repeatInterval = 1.0;
+
+// Time in milliseconds the writer thread sleeps if it is not woken up by a new message
+static constexpr int g_writerInterval = 5;
+
+static std::uint64_t HashMessage(bool isError, const char* text)
+{
+    // FNV-1a
+    std::uint64_t hash = (isError ? 0x84222325cbf29ce4ull : 0xcbf29ce484222325ull);
+    for (; *text != '\0'; ++text)
+    {
+        hash ^= static_cast<unsigned char>(*text);
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+LogSink& LogSink::Get()
+{
+    static LogSink instance;
+    return instance;
+}
+
+LogSink::~LogSink()
+{
+    Stop();
+}
+
+void LogSink::Start(long stdOutFlags)
+{
+    if (writerThread.joinable())
+        return;
+
+    if (!slots)
+    {
+        slots.reset(new Slot[g_numLogSlots]);
+        for (std::uint64_t i = 0; i < g_numLogSlots; ++i)
+            slots[i].sequence.store(i, std::memory_order_relaxed);
+        capacityMask = g_numLogSlots - 1;
+    }
+
+    this->stdOutFlags = stdOutFlags;
+    #ifdef _WIN32
+    isColored = false; // Console of Windows may not process escape sequences
+    #else
+    isColored = ((stdOutFlags & LLGL::Log::StdOutFlags::Colored) != 0 && isatty(fileno(stderr)) != 0);
+    #endif
+
+    isQuit = false;
+    writerThread = std::thread(&LogSink::RunWriter, this);
+    logHandle = LLGL::Log::RegisterCallback(LogSink::ReportCallback, this);
+}
+
+void LogSink::Stop()
+{
+    if (!writerThread.joinable())
+        return;
+
+    // Stop accepting messages before the writer is joined, so nothing is left in the ring afterwards
+    LLGL::Log::UnregisterCallback(logHandle);
+    logHandle = nullptr;
+
+    isQuit = true;
+    wakeSignal.notify_one();
+    writerThread.join();
+
+    Drain();
+    WriteRepeats(pendingRepeats.exchange(0));
+    std::fflush(stdout);
+
+    LLGL::Log::RegisterCallbackStd(stdOutFlags);
+}
+
+LogSink::Stats LogSink::GetStats() const
+{
+    Stats stats;
+    {
+        stats.numWritten    = numWritten.load(std::memory_order_relaxed);
+        stats.numDropped    = numDropped.load(std::memory_order_relaxed);
+        stats.numSuppressed = numSuppressed.load(std::memory_order_relaxed);
+    }
+    return stats;
+}
+
+void LogSink::ReportCallback(LLGL::Log::ReportType type, const char* text, void* userData)
+{
+    LogSink* self = static_cast<LogSink*>(userData);
+    const bool isError = (type == LLGL::Log::ReportType::Error);
+
+    if (self->IsRepeated(isError, text))
+        return;
+
+    if (self->Enqueue(isError, text))
+        self->wakeSignal.notify_one();
+    else
+        self->numDropped.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool LogSink::Enqueue(bool isError, const char* text)
+{
+    const std::size_t length = std::strlen(text);
+    const std::uint64_t numSlots = std::min<std::uint64_t>(std::max<std::size_t>(1, (length + slotTextSize - 1) / slotTextSize), g_maxSlotsPerMessage);
+
+    // Reserve all slots of the message at once, so it cannot be interleaved with other messages.
+    // The writer frees slots in order, so if the last slot is free, all slots before are free too.
+    std::uint64_t pos = enqueuePos.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        const std::uint64_t lastPos = pos + numSlots - 1;
+        const std::uint64_t sequence = slots[lastPos & capacityMask].sequence.load(std::memory_order_acquire);
+        const std::int64_t diff = static_cast<std::int64_t>(sequence - lastPos);
+
+        if (diff == 0)
+        {
+            if (enqueuePos.compare_exchange_weak(pos, pos + numSlots, std::memory_order_relaxed))
+                break;
+        }
+        else if (diff < 0)
+            return false;
+        else
+            pos = enqueuePos.load(std::memory_order_relaxed);
+    }
+
+    // Attach the suppressed repeats of the previous message, so they are reported right before this one
+    const std::uint32_t numRepeats = pendingRepeats.exchange(0);
+
+    for (std::uint64_t i = 0; i < numSlots; ++i)
+    {
+        const std::size_t offset = static_cast<std::size_t>(i) * slotTextSize;
+        const std::size_t chunkLength = std::min(slotTextSize, length - std::min(length, offset));
+
+        Slot& slot = slots[(pos + i) & capacityMask];
+        {
+            slot.isError        = isError;
+            slot.isContinued    = (i + 1 < numSlots);
+            slot.length         = static_cast<std::uint16_t>(chunkLength);
+            slot.numRepeats     = (i == 0 ? numRepeats : 0);
+            std::memcpy(slot.text, text + std::min(length, offset), chunkLength);
+        }
+        slot.sequence.store(pos + i + 1, std::memory_order_release);
+    }
+
+    return true;
+}
+
+bool LogSink::IsRepeated(bool isError, const char* text)
+{
+    const std::uint64_t hash = HashMessage(isError, text);
+    const std::uint64_t tick = LLGL::Timer::Tick();
+    const std::uint64_t interval = static_cast<std::uint64_t>(g_repeatInterval * static_cast<double>(LLGL::Timer::Frequency()));
+
+    // Concurrent messages may race on these values, which at worst lets a repeat through
+    if (hash == lastHash.load(std::memory_order_relaxed) && tick - lastTick.load(std::memory_order_relaxed) < interval)
+    {
+        pendingRepeats.fetch_add(1);
+        numSuppressed.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    lastHash.store(hash, std::memory_order_relaxed);
+    lastTick.store(tick, std::memory_order_relaxed);
+    return false;
+}
+
+void LogSink::Drain()
+{
+    bool hasWritten = false;
+
+    for (;; ++dequeuePos)
+    {
+        Slot& slot = slots[dequeuePos & capacityMask];
+        if (slot.sequence.load(std::memory_order_acquire) != dequeuePos + 1)
+            break;
+
+        WriteRepeats(slot.numRepeats);
+
+        std::FILE* stream = (slot.isError ? stderr : stdout);
+        if (isColored && slot.isError)
+            std::fputs("\x1b[1;31m", stream);
+        std::fwrite(slot.text, 1, slot.length, stream);
+        if (isColored && slot.isError)
+            std::fputs("\x1b[0m", stream);
+
+        if (!slot.isContinued)
+            numWritten.fetch_add(1, std::memory_order_relaxed);
+
+        slot.sequence.store(dequeuePos + capacityMask + 1, std::memory_order_release);
+        hasWritten = true;
+    }
+
+    // Report lost messages once the ring has space again
+    const std::uint64_t dropped = numDropped.load(std::memory_order_relaxed);
+    if (dropped != numDroppedReported)
+    {
+        std::fprintf(stderr, "[%llu log messages dropped]\n", static_cast<unsigned long long>(dropped - numDroppedReported));
+        numDroppedReported = dropped;
+        hasWritten = true;
+    }
+
+    if (hasWritten)
+    {
+        std::fflush(stdout);
+        std::fflush(stderr);
+    }
+}
+
+void LogSink::WriteRepeats(std::uint32_t numRepeats)
+{
+    if (numRepeats > 0)
+        std::fprintf(stdout, "[last message repeated %u more times]\n", numRepeats);
+}
+
+void LogSink::RunWriter()
+{
+    const std::uint64_t interval = static_cast<std::uint64_t>(g_repeatInterval * static_cast<double>(LLGL::Timer::Frequency()));
+
+    while (!isQuit)
+    {
+        Drain();
+
+        // Report repeats of a message that stopped repeating, since no next message may carry them
+        if (pendingRepeats.load(std::memory_order_relaxed) > 0 && LLGL::Timer::Tick() - lastTick.load(std::memory_order_relaxed) >= interval)
+        {
+            WriteRepeats(pendingRepeats.exchange(0));
+            std::fflush(stdout);
+        }
+
+        std::unique_lock<std::mutex> lock(wakeMutex);
+        wakeSignal.wait_for(lock, std::chrono::milliseconds(g_writerInterval));
+    }
+}
+
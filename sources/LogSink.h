@@ -0,0 +1,103 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * LogSink.h
+ */
+
+#pragma once
+
+#include <LLGL/Log.h>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <cstdint>
+
+
+// Asynchronous replacement for LLGL::Log::RegisterCallbackStd(). Log messages are copied into a bounded lock-free
+// ring by any number of threads and written to stdout and stderr by a background thread, so a slow terminal or pipe
+// never stalls the frame loop. If the ring is full, messages are dropped and counted instead of waiting for space.
+// A message that repeats within a short interval is suppressed and reported with its number of repeats.
+class LogSink
+{
+public:
+    struct Stats
+    {
+        std::uint64_t   numWritten      = 0;    // Messages written to the output
+        std::uint64_t   numDropped      = 0;    // Messages lost because the ring was full
+        std::uint64_t   numSuppressed   = 0;    // Repeated messages that were only counted
+    };
+
+public:
+    static LogSink& Get();
+
+    ~LogSink();
+
+    // Registers the sink as LLGL log callback and starts the writer thread. With LLGL::Log::StdOutFlags::Colored,
+    // errors are printed in red if the output is a terminal.
+    void Start(long stdOutFlags = 0);
+
+    // Writes all pending messages, stops the writer thread, and falls back to the synchronous standard callback of LLGL.
+    void Stop();
+
+    Stats GetStats() const;
+
+private:
+    // Messages longer than the text of a slot are split over consecutive slots.
+    static constexpr std::size_t slotTextSize = 248;
+
+    struct Slot
+    {
+        std::atomic<std::uint64_t>  sequence;       // Equals the enqueue position once the slot is written, and the position plus capacity once it is read
+        bool                        isError;
+        bool                        isContinued;    // Text continues in the next slot
+        std::uint16_t               length;
+        std::uint32_t               numRepeats;     // Suppressed repeats of the previous message
+        char                        text[slotTextSize];
+    };
+
+private:
+    LogSink() = default;
+
+    static void ReportCallback(LLGL::Log::ReportType type, const char* text, void* userData);
+
+    // Copies the message into the ring; returns false if the ring is full.
+    bool Enqueue(bool isError, const char* text);
+
+    // Returns true if the message repeats the previous one within the suppression interval.
+    bool IsRepeated(bool isError, const char* text);
+
+    // Writes all messages in the ring; only called by the writer thread or after it has stopped.
+    void Drain();
+
+    void WriteRepeats(std::uint32_t numRepeats);
+
+    void RunWriter();
+
+private:
+    std::unique_ptr<Slot[]>         slots;
+    std::uint64_t                   capacityMask    = 0;
+    std::atomic<std::uint64_t>      enqueuePos      { 0 };
+    std::uint64_t                   dequeuePos      = 0;    // Only accessed by the writer thread
+
+    std::atomic<std::uint64_t>      lastHash        { 0 };  // Hash of the last message that was not suppressed
+    std::atomic<std::uint64_t>      lastTick        { 0 };  // Tick of the last message that was not suppressed
+    std::atomic<std::uint32_t>      pendingRepeats  { 0 };  // Repeats of the last message that have not been reported yet
+
+    std::atomic<std::uint64_t>      numWritten      { 0 };
+    std::atomic<std::uint64_t>      numDropped      { 0 };
+    std::atomic<std::uint64_t>      numSuppressed   { 0 };
+    std::uint64_t                   numDroppedReported = 0; // Only accessed by the writer thread
+
+    long                            stdOutFlags     = 0;
+    bool                            isColored       = false;
+    LLGL::Log::LogHandle            logHandle       = nullptr;
+    std::thread                     writerThread;
+    std::mutex                      wakeMutex;
+    std::condition_variable         wakeSignal;
+    std::atomic<bool>               isQuit          { false };
+};
+
@@ -12,8 +12,15 @@
 #include "imgui.h"
 #include "Backend/Backend.h"
 #include "Globals.h"
+#include "MemoryTracker.h"
+#include "MetricsExporter.h"
+#include "LogSink.h"
+#include <stdio.h>
 #include <string.h>
+#include <stdlib.h>
+#include <algorithm>
 #include <cmath>
+#include <string>
 
 #if _WIN32
 #   include <Windows.h>
@@ -40,15 +47,102 @@ static std::unique_ptr<Backend> CreateLLGLBackend(const char* moduleName)
     #endif
 }
 
+static void PrintHelp()
+{
+    printf(
+        "Usage: Example_ImGui [MODULE] [OPTIONS]\n"
+        "\n"
+        "  MODULE                          LLGL module to load, e.g. OpenGL, Vulkan, Direct3D11; platform default otherwise\n"
+        "  --frames=N                      Quit after N frames and check memory growth and leaks\n"
+        "  --swap-buffers=N                Number of swap-chain images per window (default 2)\n"
+        "  --present=fifo|immediate        Wait for vertical blank, or present without waiting and allow tearing (default immediate)\n"
+        "                                  There is no mailbox mode: LLGL only exposes a vsync interval, so swap chains cannot\n"
+        "                                  replace a pending image without tearing\n"
+        "  --present-policy=sequential|primary|independent\n"
+        "                                  How the swap chains of multiple windows share vertical blank (default primary)\n"
+        "  --sim-rate=HZ                   Fixed-timestep simulation steps per second (default 60)\n"
+        "  --sim-thread                    Run the simulation on a separate thread\n"
+        "  --no-render-thread              Record and present frames on the main thread\n"
+        "  --no-gl-state-shadow            Use the query based state backup for ImGui in the OpenGL backend\n"
+        "  --metrics-shm=NAME              Export per-frame metrics to a shared-memory object\n"
+        "  --metrics-socket=PATH           Serve metrics in Prometheus text format on a Unix-domain socket\n"
+        "  --shader-dir=DIR                Load and hot-reload shaders from DIR, e.g. sources/Backend\n"
+        "  --viewports                     Let ImGui windows move into platform windows (docking branch of ImGui only)\n"
+        "  --sync-log                      Write log messages from the reporting thread\n"
+        "  --help                          Print this help and quit\n"
+    );
+}
+
+// Returns false if the example must quit with 'exitCode', i.e. the help was requested or an option is invalid.
+static bool ParseOptions(int argc, char* argv[], int& exitCode)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const char* arg = argv[i];
+        if (strncmp(arg, "--frames=", 9) == 0)
+            options.numFrames = strtoull(arg + 9, nullptr, 10);
+        else if (strncmp(arg, "--swap-buffers=", 15) == 0)
+            options.numSwapBuffers = std::max(1u, static_cast<std::uint32_t>(strtoul(arg + 15, nullptr, 10)));
+        else if (strcmp(arg, "--present=fifo") == 0)
+            options.presentMode = PresentMode::Fifo;
+        else if (strcmp(arg, "--present=mailbox") == 0)
+        {
+            fprintf(stderr, "--present=mailbox is not supported; LLGL can only switch vsync on (fifo) or off (immediate)\n");
+            exitCode = 1;
+            return false;
+        }
+        else if (strcmp(arg, "--present=immediate") == 0)
+            options.presentMode = PresentMode::Immediate;
+        else if (strcmp(arg, "--present-policy=sequential") == 0)
+            options.presentPolicy = PresentPolicy::Sequential;
+        else if (strcmp(arg, "--present-policy=primary") == 0)
+            options.presentPolicy = PresentPolicy::PrimaryVsync;
+        else if (strcmp(arg, "--present-policy=independent") == 0)
+            options.presentPolicy = PresentPolicy::Independent;
+        else if (strncmp(arg, "--sim-rate=", 11) == 0)
+            options.simulationRate = std::max(1.0f, static_cast<float>(atof(arg + 11)));
+        else if (strcmp(arg, "--sim-thread") == 0)
+            options.simulationThread = true;
+        else if (strcmp(arg, "--no-render-thread") == 0)
+            options.renderThread = false;
+        else if (strcmp(arg, "--no-gl-state-shadow") == 0)
+            options.shadowGLState = false;
+        else if (strncmp(arg, "--metrics-shm=", 14) == 0)
+            options.metricsShmName = arg + 14;
+        else if (strncmp(arg, "--metrics-socket=", 17) == 0)
+            options.metricsSocket = arg + 17;
+        else if (strncmp(arg, "--shader-dir=", 13) == 0)
+            options.shaderDir = arg + 13;
+        else if (strcmp(arg, "--viewports") == 0)
+            options.imGuiViewports = true;
+        else if (strcmp(arg, "--sync-log") == 0)
+            options.asyncLog = false;
+        else if (strcmp(arg, "--help") == 0)
+        {
+            PrintHelp();
+            exitCode = 0;
+            return false;
+        }
+        else if (*arg != '-')
+            options.moduleName = arg;
+    }
+    return true;
+}
+
 static int InitExample(const char* moduleName)
 {
-    // Initialize logging
+    // Initialize logging; the asynchronous sink keeps slow terminals and pipes out of the frame loop
     #ifdef __APPLE__
-    LLGL::Log::RegisterCallbackStd();
+    const long stdOutFlags = 0;
     #else
-    LLGL::Log::RegisterCallbackStd(LLGL::Log::StdOutFlags::Colored);
+    const long stdOutFlags = LLGL::Log::StdOutFlags::Colored;
     #endif
 
+    if (options.asyncLog)
+        LogSink::Get().Start(stdOutFlags);
+    else
+        LLGL::Log::RegisterCallbackStd(stdOutFlags);
+
     // Create LLGL backend
     g_backend = CreateLLGLBackend(moduleName);
     if (!g_backend)
@@ -65,11 +159,48 @@ static int InitExample(const char* moduleName)
     g_backend->Init();
 #endif
 
+    // Start metrics export; the shared memory must be opened first, so the socket serves from the same ring buffer
+    if (options.metricsShmName != nullptr)
+        MetricsExporter::Get().OpenSharedMemory(options.metricsShmName);
+    if (options.metricsSocket != nullptr)
+        MetricsExporter::Get().OpenSocket(options.metricsSocket);
+
     return 0;
 }
 
+// Reports memory growth over the run and ImGui heap leaks after shutdown; returns true if the check failed.
+static bool CheckMemoryGrowth()
+{
+    constexpr std::uint64_t growthTolerance = 1024*1024;
+
+    std::string report;
+    const bool hasGrown = MemoryTracker::Get().CheckForGrowth(growthTolerance, report);
+
+    if (hasGrown)
+        LLGL::Log::Errorf(LLGL::Log::ColorFlags::StdError, "%s", report.c_str());
+    else
+        LLGL::Log::Printf("%s", report.c_str());
+
+    return hasGrown;
+}
+
+static bool CheckMemoryLeaks()
+{
+    std::string report;
+    const bool hasLeaks = MemoryTracker::Get().CheckForLeaks(report);
+
+    if (hasLeaks)
+        LLGL::Log::Errorf(LLGL::Log::ColorFlags::StdError, "%s", report.c_str());
+    else
+        LLGL::Log::Printf("%s", report.c_str());
+
+    return hasLeaks;
+}
+
 static void ShutdownExample()
 {
+    MetricsExporter::Get().Close();
+
 #if WITH_IMGUI
     // Shutdown ImGui
     g_backend->Release();
@@ -80,6 +211,9 @@ static void ShutdownExample()
 
     // Unload LLGL
     LLGL::RenderSystem::Unload(std::move(renderer));
+
+    // Write remaining log messages; later reports go to the standard output directly
+    LogSink::Get().Stop();
 }
 
 #if _WIN32
@@ -89,23 +223,43 @@ int main(int argc, char* argv[])
 #endif
 {
     // Initialize example backend and ImGui
+    int exitCode = 0;
 #if _WIN32
-    int init = InitExample(cmdLine);
+    if (!ParseOptions(__argc, __argv, exitCode))
 #else
-    int init = InitExample(argc >= 2 ? argv[1] : nullptr);
+    if (!ParseOptions(argc, argv, exitCode))
 #endif
+        return exitCode;
+
+    int init = InitExample(options.moduleName);
     if (init != 0)
         return init;
 
+    // Capture the memory baseline after a quarter of a limited run
+    if (options.numFrames > 0)
+        MemoryTracker::Get().SetWarmupFrames(options.numFrames / 4);
+
+    std::uint64_t frameCounter = 0;
+
     while (LLGL::Surface::ProcessEvents() && !quitDemo && g_backend->IsAnyWindowOpen())
     {
         // Render frame and present result on screen
         g_backend->RenderSceneForAllContexts();
+
+        MemoryTracker::Get().SampleFrame();
+
+        if (options.numFrames > 0 && ++frameCounter >= options.numFrames)
+            break;
     }
 
+    // Only limited runs are checked, since interactive sessions may legitimately allocate more
+    const bool hasGrown = (options.numFrames > 0 && CheckMemoryGrowth());
+
     ShutdownExample();
 
-    return 0;
+    const bool hasLeaks = (options.numFrames > 0 && CheckMemoryLeaks());
+
+    return (hasGrown || hasLeaks ? 1 : 0);
 }
 
 
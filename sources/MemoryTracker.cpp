@@ -0,0 +1,368 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * MemoryTracker.cpp
+ */
+
+#include "MemoryTracker.h"
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+
+/*
+ * Lock-free counters; these must not depend on dynamic initialization,
+ * because the global operator new can be invoked before main().
+ */
+
+static constexpr int g_numCategories = static_cast<int>(MemoryCategory::Count);
+
+struct AtomicMemoryCounter
+{
+    std::atomic<std::uint64_t> liveBytes;
+    std::atomic<std::uint64_t> liveCount;
+    std::atomic<std::uint64_t> peakBytes;
+    std::atomic<std::uint64_t> totalCount;
+};
+
+static AtomicMemoryCounter  g_counters[g_numCategories];
+static AtomicMemoryCounter  g_windowCounters[MemoryTracker::maxWindows][g_numCategories];
+
+static void AddToCounter(AtomicMemoryCounter& counter, std::uint64_t size)
+{
+    const std::uint64_t liveBytes = counter.liveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+    counter.liveCount.fetch_add(1, std::memory_order_relaxed);
+    counter.totalCount.fetch_add(1, std::memory_order_relaxed);
+
+    std::uint64_t peakBytes = counter.peakBytes.load(std::memory_order_relaxed);
+    while (liveBytes > peakBytes && !counter.peakBytes.compare_exchange_weak(peakBytes, liveBytes, std::memory_order_relaxed))
+    {
+        // Retry until the high-water mark is at least the new live size
+    }
+}
+
+static void SubFromCounter(AtomicMemoryCounter& counter, std::uint64_t size)
+{
+    counter.liveBytes.fetch_sub(size, std::memory_order_relaxed);
+    counter.liveCount.fetch_sub(1, std::memory_order_relaxed);
+}
+
+static void AddAllocation(MemoryCategory category, int windowIndex, std::uint64_t size)
+{
+    const int categoryIndex = static_cast<int>(category);
+    AddToCounter(g_counters[categoryIndex], size);
+    if (windowIndex >= 0 && windowIndex < MemoryTracker::maxWindows)
+        AddToCounter(g_windowCounters[windowIndex][categoryIndex], size);
+}
+
+static void SubAllocation(MemoryCategory category, int windowIndex, std::uint64_t size)
+{
+    const int categoryIndex = static_cast<int>(category);
+    SubFromCounter(g_counters[categoryIndex], size);
+    if (windowIndex >= 0 && windowIndex < MemoryTracker::maxWindows)
+        SubFromCounter(g_windowCounters[windowIndex][categoryIndex], size);
+}
+
+static MemoryStats LoadCounter(const AtomicMemoryCounter& counter)
+{
+    MemoryStats stats;
+    {
+        stats.liveBytes     = counter.liveBytes.load(std::memory_order_relaxed);
+        stats.liveCount     = counter.liveCount.load(std::memory_order_relaxed);
+        stats.peakBytes     = counter.peakBytes.load(std::memory_order_relaxed);
+        stats.totalCount    = counter.totalCount.load(std::memory_order_relaxed);
+    }
+    return stats;
+}
+
+static bool IsHeapCategory(MemoryCategory category)
+{
+    return (category == MemoryCategory::ImGuiHeap || category == MemoryCategory::GlobalHeap);
+}
+
+
+/*
+ * Heap allocations are prefixed with a header that stores the size and owner,
+ * so the free functions can update the same counters without a lookup table.
+ */
+
+struct alignas(16) HeapAllocationHeader
+{
+    std::uint64_t   size;
+    std::int16_t    windowIndex;
+    std::uint16_t   category;
+    std::uint32_t   reserved;
+};
+
+static_assert(sizeof(HeapAllocationHeader) == 16, "HeapAllocationHeader must preserve 16 byte alignment");
+
+static void* TrackedMalloc(std::size_t size, MemoryCategory category, int windowIndex)
+{
+    void* block = std::malloc(sizeof(HeapAllocationHeader) + size);
+    if (block == nullptr)
+        return nullptr;
+
+    HeapAllocationHeader* header = static_cast<HeapAllocationHeader*>(block);
+    {
+        header->size        = size;
+        header->windowIndex = static_cast<std::int16_t>(windowIndex);
+        header->category    = static_cast<std::uint16_t>(category);
+        header->reserved    = 0;
+    }
+    AddAllocation(category, windowIndex, size);
+
+    return header + 1;
+}
+
+static void TrackedFree(void* ptr)
+{
+    if (ptr == nullptr)
+        return;
+
+    HeapAllocationHeader* header = static_cast<HeapAllocationHeader*>(ptr) - 1;
+    SubAllocation(static_cast<MemoryCategory>(header->category), header->windowIndex, header->size);
+    std::free(header);
+}
+
+
+/*
+ * MemoryTracker class
+ */
+
+const char* ToString(MemoryCategory category)
+{
+    switch (category)
+    {
+        case MemoryCategory::Buffer:        return "Buffers";
+        case MemoryCategory::SwapChain:     return "Swap-Chains";
+        case MemoryCategory::PipelineState: return "PSOs";
+        case MemoryCategory::Texture:       return "Textures";
+        case MemoryCategory::ImGuiHeap:     return "ImGui Heap";
+        case MemoryCategory::GlobalHeap:    return "Global Heap";
+        default:                            return "<unknown>";
+    }
+}
+
+MemoryTracker& MemoryTracker::Get()
+{
+    static MemoryTracker instance;
+    return instance;
+}
+
+void MemoryTracker::TrackResource(const void* resource, MemoryCategory category, std::uint64_t size, const char* debugName, int windowIndex)
+{
+    if (resource == nullptr)
+        return;
+
+    std::lock_guard<std::mutex> guard{ resourceMutex };
+
+    auto it = resources.find(resource);
+    if (it != resources.end())
+        SubAllocation(it->second.category, it->second.windowIndex, it->second.size);
+
+    ResourceRecord& record = resources[resource];
+
+    record.category     = category;
+    record.size         = size;
+    record.debugName    = (debugName != nullptr ? debugName : "<unnamed>");
+    record.windowIndex  = windowIndex;
+
+    AddAllocation(category, windowIndex, size);
+}
+
+void MemoryTracker::UntrackResource(const void* resource)
+{
+    std::lock_guard<std::mutex> guard{ resourceMutex };
+
+    auto it = resources.find(resource);
+    if (it != resources.end())
+    {
+        SubAllocation(it->second.category, it->second.windowIndex, it->second.size);
+        resources.erase(it);
+    }
+}
+
+void MemoryTracker::AddHeapAllocation(MemoryCategory category, int windowIndex, std::uint64_t size)
+{
+    AddAllocation(category, windowIndex, size);
+}
+
+void MemoryTracker::RemoveHeapAllocation(MemoryCategory category, int windowIndex, std::uint64_t size)
+{
+    SubAllocation(category, windowIndex, size);
+}
+
+MemoryStats MemoryTracker::GetStats(MemoryCategory category) const
+{
+    return LoadCounter(g_counters[static_cast<int>(category)]);
+}
+
+MemoryStats MemoryTracker::GetWindowStats(int windowIndex, MemoryCategory category) const
+{
+    if (windowIndex >= 0 && windowIndex < maxWindows)
+        return LoadCounter(g_windowCounters[windowIndex][static_cast<int>(category)]);
+    else
+        return MemoryStats{};
+}
+
+std::uint64_t MemoryTracker::GetTotalLiveBytes() const
+{
+    std::uint64_t total = 0;
+    for (int i = 0; i < g_numCategories; ++i)
+        total += g_counters[i].liveBytes.load(std::memory_order_relaxed);
+    return total;
+}
+
+std::uint64_t MemoryTracker::GetTotalPeakBytes() const
+{
+    std::uint64_t total = 0;
+    for (int i = 0; i < g_numCategories; ++i)
+        total += g_counters[i].peakBytes.load(std::memory_order_relaxed);
+    return total;
+}
+
+static void SumLiveBytes(std::uint64_t& outHeapBytes, std::uint64_t& outGPUBytes)
+{
+    outHeapBytes    = 0;
+    outGPUBytes     = 0;
+    for (int i = 0; i < g_numCategories; ++i)
+    {
+        const std::uint64_t liveBytes = g_counters[i].liveBytes.load(std::memory_order_relaxed);
+        if (IsHeapCategory(static_cast<MemoryCategory>(i)))
+            outHeapBytes += liveBytes;
+        else
+            outGPUBytes += liveBytes;
+    }
+}
+
+void MemoryTracker::SampleFrame()
+{
+    history[numFrames % historySize] = static_cast<float>(static_cast<double>(GetTotalLiveBytes()) / (1024.0 * 1024.0));
+    ++numFrames;
+
+    if (!hasBaseline && numFrames >= warmupFrames)
+    {
+        SumLiveBytes(baselineHeapBytes, baselineGPUBytes);
+        hasBaseline = true;
+    }
+}
+
+bool MemoryTracker::CheckForGrowth(std::uint64_t toleranceBytes, std::string& outReport) const
+{
+    if (!hasBaseline)
+    {
+        outReport = "memory growth check skipped: run ended before warmup (" + std::to_string(warmupFrames) + " frames)\n";
+        return false;
+    }
+
+    std::uint64_t heapBytes = 0, gpuBytes = 0;
+    SumLiveBytes(heapBytes, gpuBytes);
+
+    const bool heapGrew = (heapBytes > baselineHeapBytes + toleranceBytes);
+    const bool gpuGrew  = (gpuBytes  > baselineGPUBytes  + toleranceBytes);
+
+    char line[256];
+    std::snprintf(
+        line, sizeof(line), "memory growth after %llu frames: heap %llu -> %llu bytes, GPU %llu -> %llu bytes (tolerance %llu bytes)\n",
+        static_cast<unsigned long long>(numFrames),
+        static_cast<unsigned long long>(baselineHeapBytes), static_cast<unsigned long long>(heapBytes),
+        static_cast<unsigned long long>(baselineGPUBytes), static_cast<unsigned long long>(gpuBytes),
+        static_cast<unsigned long long>(toleranceBytes)
+    );
+    outReport = line;
+
+    return (heapGrew || gpuGrew);
+}
+
+bool MemoryTracker::CheckForLeaks(std::string& outReport) const
+{
+    const MemoryStats imGuiStats = GetStats(MemoryCategory::ImGuiHeap);
+    if (imGuiStats.liveCount == 0)
+    {
+        outReport = "no ImGui heap leaks\n";
+        return false;
+    }
+
+    char line[256];
+    std::snprintf(
+        line, sizeof(line), "ImGui heap leaks: %llu allocation(s) with %llu bytes still alive\n",
+        static_cast<unsigned long long>(imGuiStats.liveCount), static_cast<unsigned long long>(imGuiStats.liveBytes)
+    );
+    outReport = line;
+
+    return true;
+}
+
+void MemoryTracker::SetWarmupFrames(std::uint64_t frames)
+{
+    warmupFrames = frames;
+}
+
+std::vector<MemoryTracker::ResourceRecord> MemoryTracker::GetResourceRecords() const
+{
+    std::lock_guard<std::mutex> guard{ resourceMutex };
+
+    std::vector<ResourceRecord> records;
+    records.reserve(resources.size());
+    for (const auto& it : resources)
+        records.push_back(it.second);
+
+    return records;
+}
+
+
+/*
+ * Global operator new/delete replacements
+ */
+
+#if WITH_HEAP_TRACKING
+
+void* operator new (std::size_t size)
+{
+    if (void* ptr = TrackedMalloc(size, MemoryCategory::GlobalHeap, -1))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new[] (std::size_t size)
+{
+    if (void* ptr = TrackedMalloc(size, MemoryCategory::GlobalHeap, -1))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new (std::size_t size, const std::nothrow_t&) noexcept
+{
+    return TrackedMalloc(size, MemoryCategory::GlobalHeap, -1);
+}
+
+void* operator new[] (std::size_t size, const std::nothrow_t&) noexcept
+{
+    return TrackedMalloc(size, MemoryCategory::GlobalHeap, -1);
+}
+
+void operator delete (void* ptr) noexcept
+{
+    TrackedFree(ptr);
+}
+
+void operator delete[] (void* ptr) noexcept
+{
+    TrackedFree(ptr);
+}
+
+void operator delete (void* ptr, const std::nothrow_t&) noexcept
+{
+    TrackedFree(ptr);
+}
+
+void operator delete[] (void* ptr, const std::nothrow_t&) noexcept
+{
+    TrackedFree(ptr);
+}
+
+#endif // /WITH_HEAP_TRACKING
+
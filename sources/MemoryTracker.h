@@ -0,0 +1,114 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * MemoryTracker.h
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+#ifndef WITH_HEAP_TRACKING
+#define WITH_HEAP_TRACKING 1
+#endif
+
+
+enum class MemoryCategory
+{
+    Buffer = 0,
+    SwapChain,
+    PipelineState,
+    Texture,
+    ImGuiHeap,
+    GlobalHeap,
+
+    Count,
+};
+
+const char* ToString(MemoryCategory category);
+
+// Snapshot of a single memory counter.
+struct MemoryStats
+{
+    std::uint64_t liveBytes     = 0;
+    std::uint64_t liveCount     = 0;
+    std::uint64_t peakBytes     = 0;
+    std::uint64_t totalCount    = 0;
+};
+
+// Tracks LLGL resources by their object pointer and heap allocations by category and window.
+class MemoryTracker
+{
+public:
+    static constexpr int maxWindows     = 8;
+    static constexpr int historySize    = 256;
+
+    struct ResourceRecord
+    {
+        MemoryCategory  category    = MemoryCategory::Buffer;
+        std::uint64_t   size        = 0;
+        std::string     debugName;
+        int             windowIndex = -1;
+    };
+
+public:
+    static MemoryTracker& Get();
+
+    // Tracks the specified resource. Tracking the same resource again replaces its previous record, e.g. after a resize.
+    void TrackResource(const void* resource, MemoryCategory category, std::uint64_t size, const char* debugName, int windowIndex = -1);
+    void UntrackResource(const void* resource);
+
+    // Accounts heap allocations made by custom allocators, e.g. ImGuiAllocator. These only update lock-free counters.
+    static void AddHeapAllocation(MemoryCategory category, int windowIndex, std::uint64_t size);
+    static void RemoveHeapAllocation(MemoryCategory category, int windowIndex, std::uint64_t size);
+
+    MemoryStats GetStats(MemoryCategory category) const;
+    MemoryStats GetWindowStats(int windowIndex, MemoryCategory category) const;
+    std::uint64_t GetTotalLiveBytes() const;
+    std::uint64_t GetTotalPeakBytes() const;
+
+    // Appends the current totals to the history and captures the growth baseline after the warmup frames.
+    void SampleFrame();
+
+    // Returns true if the live heap bytes have grown by more than the tolerance since the baseline was captured.
+    bool CheckForGrowth(std::uint64_t toleranceBytes, std::string& outReport) const;
+
+    // Returns true if ImGui heap allocations are still alive, i.e. after all ImGui contexts have been destroyed.
+    bool CheckForLeaks(std::string& outReport) const;
+
+    void SetWarmupFrames(std::uint64_t frames);
+
+    std::vector<ResourceRecord> GetResourceRecords() const;
+
+    const float* GetHistory() const
+    {
+        return history;
+    }
+
+    int GetHistoryOffset() const
+    {
+        return static_cast<int>(numFrames % historySize);
+    }
+
+private:
+    MemoryTracker() = default;
+
+private:
+    mutable std::mutex                                  resourceMutex;
+    std::unordered_map<const void*, ResourceRecord>     resources;
+
+    std::uint64_t                                       numFrames           = 0;
+    std::uint64_t                                       warmupFrames        = 120;
+    std::uint64_t                                       baselineHeapBytes   = 0;
+    std::uint64_t                                       baselineGPUBytes    = 0;
+    bool                                                hasBaseline         = false;
+    float                                               history[historySize] = {};
+};
+
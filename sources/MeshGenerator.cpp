@@ -0,0 +1,259 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * MeshGenerator.cpp
+ */
+
+#include "MeshGenerator.h"
+#include "JobSystem.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+
+static constexpr float          g_pi                = 3.14159265359f;
+static constexpr std::uint32_t  g_vertexColor       = 0xFFFFFFFF;
+static constexpr float          g_torusMajorRadius  = 1.0f;
+static constexpr float          g_torusMinorRadius  = 0.4f;
+
+// Minimum number of vertices per job before the generation is split across workers
+static constexpr std::uint32_t  g_minVerticesPerJob = 16384;
+
+/*
+ * All meshes consist of one or more parametric grids. Each grid is evaluated at (u, v) in [0, 1]
+ * and the parametrization is chosen such that cross(dP/dv, dP/du) points outwards,
+ * which makes the triangles (a, a+dv, a+du+dv) clockwise, i.e. front facing, from the outside.
+ */
+struct MeshGrid
+{
+    MeshType        type;
+    int             face;           // Cube face index; unused for other mesh types
+    std::uint32_t   columns;        // Number of quads along u
+    std::uint32_t   rows;           // Number of quads along v
+    std::uint32_t   firstVertex;
+    std::uint32_t   firstIndex;
+};
+
+struct CubeFace
+{
+    float normal[3];
+    float axisU[3];
+    float axisV[3];
+};
+
+static const CubeFace g_cubeFaces[6] =
+{
+    { {  0,  0, -1 }, { +1,  0,  0 }, {  0, +1,  0 } }, // front
+    { { +1,  0,  0 }, {  0,  0, +1 }, {  0, +1,  0 } }, // right
+    { { -1,  0,  0 }, {  0,  0, -1 }, {  0, +1,  0 } }, // left
+    { {  0, +1,  0 }, { +1,  0,  0 }, {  0,  0, +1 } }, // top
+    { {  0, -1,  0 }, { +1,  0,  0 }, {  0,  0, -1 } }, // bottom
+    { {  0,  0, +1 }, { -1,  0,  0 }, {  0, +1,  0 } }, // back
+};
+
+static void SetVertex(Vertex& vertex, float px, float py, float pz, float nx, float ny, float nz)
+{
+    vertex.position[0]  = px;
+    vertex.position[1]  = py;
+    vertex.position[2]  = pz;
+    vertex.normal[0]    = nx;
+    vertex.normal[1]    = ny;
+    vertex.normal[2]    = nz;
+    vertex.color        = g_vertexColor;
+}
+
+static void EvaluateGrid(const MeshGrid& grid, float u, float v, Vertex& outVertex)
+{
+    switch (grid.type)
+    {
+        case MeshType::Cube:
+        {
+            const CubeFace& face = g_cubeFaces[grid.face];
+            const float s = u*2.0f - 1.0f;
+            const float t = v*2.0f - 1.0f;
+            SetVertex(
+                outVertex,
+                face.normal[0] + face.axisU[0]*s + face.axisV[0]*t,
+                face.normal[1] + face.axisU[1]*s + face.axisV[1]*t,
+                face.normal[2] + face.axisU[2]*s + face.axisV[2]*t,
+                face.normal[0], face.normal[1], face.normal[2]
+            );
+        }
+        break;
+
+        case MeshType::Sphere:
+        {
+            const float longitude   = u*2.0f*g_pi;
+            const float latitude    = (v - 0.5f)*g_pi;
+            const float nx          = std::cos(latitude)*std::cos(longitude);
+            const float ny          = std::sin(latitude);
+            const float nz          = std::cos(latitude)*std::sin(longitude);
+            SetVertex(outVertex, nx, ny, nz, nx, ny, nz);
+        }
+        break;
+
+        case MeshType::Torus:
+        {
+            const float alpha   = u*2.0f*g_pi;
+            const float beta    = v*2.0f*g_pi;
+            const float nx      = std::cos(beta)*std::cos(alpha);
+            const float ny      = std::sin(beta);
+            const float nz      = std::cos(beta)*std::sin(alpha);
+            SetVertex(
+                outVertex,
+                std::cos(alpha)*g_torusMajorRadius + nx*g_torusMinorRadius,
+                ny*g_torusMinorRadius,
+                std::sin(alpha)*g_torusMajorRadius + nz*g_torusMinorRadius,
+                nx, ny, nz
+            );
+        }
+        break;
+
+        case MeshType::Plane:
+        {
+            SetVertex(outVertex, u*2.0f - 1.0f, v*2.0f - 1.0f, 0.0f, 0.0f, 0.0f, -1.0f);
+        }
+        break;
+    }
+}
+
+static std::vector<MeshGrid> GetMeshGrids(const MeshDescriptor& desc)
+{
+    std::vector<MeshGrid> grids;
+
+    auto AddGrid = [&grids](MeshType type, int face, std::uint32_t columns, std::uint32_t rows)
+    {
+        MeshGrid grid = { type, face, columns, rows, 0, 0 };
+        if (!grids.empty())
+        {
+            const MeshGrid& prev = grids.back();
+            grid.firstVertex    = prev.firstVertex + (prev.columns + 1)*(prev.rows + 1);
+            grid.firstIndex     = prev.firstIndex + prev.columns*prev.rows*6;
+        }
+        grids.push_back(grid);
+    };
+
+    const std::uint32_t n = std::max(1u, desc.tessellation);
+
+    switch (desc.type)
+    {
+        case MeshType::Cube:
+            for (int face = 0; face < 6; ++face)
+                AddGrid(MeshType::Cube, face, n, n);
+            break;
+
+        case MeshType::Sphere:
+            AddGrid(MeshType::Sphere, 0, std::max(3u, n*2), std::max(2u, n));
+            break;
+
+        case MeshType::Torus:
+            AddGrid(MeshType::Torus, 0, std::max(3u, n*2), std::max(3u, n));
+            break;
+
+        case MeshType::Plane:
+            AddGrid(MeshType::Plane, 0, n, n);
+            break;
+    }
+
+    return grids;
+}
+
+MeshSize GetMeshSize(const MeshDescriptor& desc)
+{
+    MeshSize size;
+    for (const MeshGrid& grid : GetMeshGrids(desc))
+    {
+        size.numVertices    += (grid.columns + 1)*(grid.rows + 1);
+        size.numIndices     += grid.columns*grid.rows*6;
+    }
+    return size;
+}
+
+void GetMeshBounds(const MeshDescriptor& desc, float (&outMin)[3], float (&outMax)[3])
+{
+    float extent[3] = { 1.0f, 1.0f, 1.0f };
+    switch (desc.type)
+    {
+        case MeshType::Cube:
+        case MeshType::Sphere:
+            break;
+
+        case MeshType::Torus:
+            extent[0] = g_torusMajorRadius + g_torusMinorRadius;
+            extent[1] = g_torusMinorRadius;
+            extent[2] = g_torusMajorRadius + g_torusMinorRadius;
+            break;
+
+        case MeshType::Plane:
+            extent[2] = 0.0f;
+            break;
+    }
+
+    for (int i = 0; i < 3; ++i)
+    {
+        outMin[i] = -extent[i];
+        outMax[i] = +extent[i];
+    }
+}
+
+// Writes one row of vertices and, except for the last row, the quads between this row and the next one.
+static void GenerateGridRow(const MeshGrid& grid, std::uint32_t row, Vertex* outVertices, std::uint32_t* outIndices)
+{
+    const std::uint32_t stride = grid.columns + 1;
+    const float         v      = static_cast<float>(row) / static_cast<float>(grid.rows);
+
+    Vertex* vertices = outVertices + grid.firstVertex + row*stride;
+    for (std::uint32_t column = 0; column <= grid.columns; ++column)
+        EvaluateGrid(grid, static_cast<float>(column) / static_cast<float>(grid.columns), v, vertices[column]);
+
+    if (row < grid.rows)
+    {
+        std::uint32_t* indices = outIndices + grid.firstIndex + row*grid.columns*6;
+        for (std::uint32_t column = 0; column < grid.columns; ++column)
+        {
+            const std::uint32_t i0 = grid.firstVertex + row*stride + column;
+            const std::uint32_t i1 = i0 + stride;
+            *indices++ = i0;
+            *indices++ = i1;
+            *indices++ = i1 + 1;
+            *indices++ = i0;
+            *indices++ = i1 + 1;
+            *indices++ = i0 + 1;
+        }
+    }
+}
+
+void GenerateMesh(const MeshDescriptor& desc, Vertex* outVertices, std::uint32_t* outIndices)
+{
+    const std::vector<MeshGrid> grids = GetMeshGrids(desc);
+
+    // Flatten the vertex rows of all grids so they can be split evenly across jobs
+    std::vector<std::uint32_t> rowOffsets;
+    rowOffsets.reserve(grids.size() + 1);
+    rowOffsets.push_back(0);
+    for (const MeshGrid& grid : grids)
+        rowOffsets.push_back(rowOffsets.back() + grid.rows + 1);
+
+    const std::uint32_t numRows     = rowOffsets.back();
+    const std::uint32_t numVertices = GetMeshSize(desc).numVertices;
+
+    auto GenerateRows = [&](std::uint32_t begin, std::uint32_t end)
+    {
+        std::size_t gridIndex = 0;
+        for (std::uint32_t i = begin; i < end; ++i)
+        {
+            while (i >= rowOffsets[gridIndex + 1])
+                ++gridIndex;
+            GenerateGridRow(grids[gridIndex], i - rowOffsets[gridIndex], outVertices, outIndices);
+        }
+    };
+
+    // Split rows into jobs of roughly equal vertex counts; small meshes are generated inline
+    const std::uint32_t verticesPerRow  = std::max(1u, numVertices / std::max(1u, numRows));
+    const std::uint32_t rowsPerJob      = std::max(1u, g_minVerticesPerJob / verticesPerRow);
+
+    JobSystem::Get().ParallelFor(numRows, rowsPerJob, GenerateRows);
+}
+
@@ -0,0 +1,50 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * MeshGenerator.h
+ */
+
+#pragma once
+
+#include <cstdint>
+
+
+struct Vertex
+{
+    float           position[3];
+    float           normal[3];
+    std::uint32_t   color;
+};
+
+enum class MeshType
+{
+    Cube = 0,
+    Sphere,
+    Torus,
+    Plane,
+};
+
+struct MeshDescriptor
+{
+    MeshType        type            = MeshType::Cube;
+    std::uint32_t   tessellation    = 1;    // Number of quads along each edge of the parametric grid(s)
+};
+
+struct MeshSize
+{
+    std::uint32_t   numVertices     = 0;
+    std::uint32_t   numIndices      = 0;
+};
+
+// Returns the number of vertices and indices GenerateMesh() will write for the specified mesh.
+MeshSize GetMeshSize(const MeshDescriptor& desc);
+
+// Returns the local bounding box of the specified mesh.
+void GetMeshBounds(const MeshDescriptor& desc, float (&outMin)[3], float (&outMax)[3]);
+
+// Generates the mesh directly into the pre-sized output arrays, e.g. mapped GPU buffers.
+// The parametric grid rows are split into jobs of the JobSystem; small meshes are generated on the calling thread.
+void GenerateMesh(const MeshDescriptor& desc, Vertex* outVertices, std::uint32_t* outIndices);
+
@@ -0,0 +1,537 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * MeshOptimizer.cpp
+ */
+
+#include "MeshOptimizer.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+
+static constexpr std::uint32_t g_invalidIndex = 0xFFFFFFFFu;
+
+static void Sub3(const float* a, const float* b, float* out)
+{
+    out[0] = a[0] - b[0];
+    out[1] = a[1] - b[1];
+    out[2] = a[2] - b[2];
+}
+
+static void Cross3(const float* a, const float* b, float* out)
+{
+    out[0] = a[1]*b[2] - a[2]*b[1];
+    out[1] = a[2]*b[0] - a[0]*b[2];
+    out[2] = a[0]*b[1] - a[1]*b[0];
+}
+
+static float Dot3(const float* a, const float* b)
+{
+    return a[0]*b[0] + a[1]*b[1] + a[2]*b[2];
+}
+
+static float Normalize3(float* v)
+{
+    const float len = std::sqrt(Dot3(v, v));
+    if (len > 0.0f)
+    {
+        v[0] /= len;
+        v[1] /= len;
+        v[2] /= len;
+    }
+    return len;
+}
+
+// Unnormalized face normal; front faces of the generated meshes have this normal pointing outwards
+static void TriangleNormal(const Vertex* vertices, const std::uint32_t* triangle, float* outNormal)
+{
+    float e1[3], e2[3];
+    Sub3(vertices[triangle[1]].position, vertices[triangle[0]].position, e1);
+    Sub3(vertices[triangle[2]].position, vertices[triangle[0]].position, e2);
+    Cross3(e1, e2, outNormal);
+}
+
+
+/*
+ * Vertex cache analysis
+ */
+
+VertexCacheStats AnalyzeVertexCache(const std::uint32_t* indices, std::size_t numIndices, std::uint32_t numVertices, std::uint32_t cacheSize)
+{
+    VertexCacheStats stats;
+    if (numIndices == 0 || numVertices == 0)
+        return stats;
+
+    // A vertex is in the FIFO cache if fewer than 'cacheSize' misses occurred since it was inserted
+    std::vector<std::uint32_t> timestamps(numVertices, 0);
+    std::uint32_t time = cacheSize + 1;
+    std::uint32_t numMisses = 0;
+    std::uint32_t numUniqueVertices = 0;
+
+    for (std::size_t i = 0; i < numIndices; ++i)
+    {
+        const std::uint32_t v = indices[i];
+        if (timestamps[v] == 0)
+            ++numUniqueVertices;
+        if (time - timestamps[v] > cacheSize)
+        {
+            timestamps[v] = time++;
+            ++numMisses;
+        }
+    }
+
+    stats.acmr = static_cast<float>(numMisses) / static_cast<float>(numIndices / 3);
+    stats.atvr = static_cast<float>(numMisses) / static_cast<float>(std::max(1u, numUniqueVertices));
+
+    return stats;
+}
+
+
+/*
+ * Tipsify
+ */
+
+struct VertexAdjacency
+{
+    std::vector<std::uint32_t> offsets;     // Per vertex offset into 'triangles'; one additional entry at the end
+    std::vector<std::uint32_t> triangles;
+};
+
+static void BuildVertexAdjacency(VertexAdjacency& outAdjacency, std::vector<std::uint32_t>& outLiveCounts, const std::uint32_t* indices, std::size_t numIndices, std::uint32_t numVertices)
+{
+    outLiveCounts.assign(numVertices, 0);
+    for (std::size_t i = 0; i < numIndices; ++i)
+        outLiveCounts[indices[i]]++;
+
+    outAdjacency.offsets.resize(numVertices + 1);
+    outAdjacency.offsets[0] = 0;
+    for (std::uint32_t v = 0; v < numVertices; ++v)
+        outAdjacency.offsets[v + 1] = outAdjacency.offsets[v] + outLiveCounts[v];
+
+    std::vector<std::uint32_t> fillOffsets(outAdjacency.offsets.begin(), outAdjacency.offsets.end() - 1);
+    outAdjacency.triangles.resize(numIndices);
+    for (std::size_t i = 0; i < numIndices; ++i)
+        outAdjacency.triangles[fillOffsets[indices[i]]++] = static_cast<std::uint32_t>(i / 3);
+}
+
+std::vector<std::uint32_t> OptimizeVertexCache(std::uint32_t* indices, std::size_t numIndices, std::uint32_t numVertices, std::uint32_t cacheSize)
+{
+    std::vector<std::uint32_t> clusters;
+    if (numIndices < 3 || numVertices == 0)
+        return clusters;
+
+    const std::size_t numTriangles = numIndices / 3;
+
+    VertexAdjacency adjacency;
+    std::vector<std::uint32_t> liveCounts;
+    BuildVertexAdjacency(adjacency, liveCounts, indices, numIndices, numVertices);
+
+    std::vector<std::uint32_t>  timestamps(numVertices, 0);
+    std::vector<std::uint32_t>  deadEndStack;
+    std::vector<std::uint32_t>  candidates;
+    std::vector<bool>           emitted(numTriangles, false);
+    std::vector<std::uint32_t>  output;
+
+    deadEndStack.reserve(numIndices);
+    output.reserve(numIndices);
+
+    std::uint32_t time = cacheSize + 1;
+    std::uint32_t cursor = 0;
+
+    // Returns the most recent dead-end vertex with remaining triangles or the next such vertex in input order
+    auto SkipDeadEnd = [&]() -> std::uint32_t
+    {
+        while (!deadEndStack.empty())
+        {
+            const std::uint32_t v = deadEndStack.back();
+            deadEndStack.pop_back();
+            if (liveCounts[v] > 0)
+                return v;
+        }
+        for (; cursor < numVertices; ++cursor)
+        {
+            if (liveCounts[cursor] > 0)
+                return cursor;
+        }
+        return g_invalidIndex;
+    };
+
+    std::uint32_t fanningVertex = SkipDeadEnd();
+    clusters.push_back(0);
+
+    while (fanningVertex != g_invalidIndex)
+    {
+        // Emit all remaining triangles around the fanning vertex
+        candidates.clear();
+        for (std::uint32_t i = adjacency.offsets[fanningVertex]; i < adjacency.offsets[fanningVertex + 1]; ++i)
+        {
+            const std::uint32_t triangle = adjacency.triangles[i];
+            if (emitted[triangle])
+                continue;
+
+            for (int k = 0; k < 3; ++k)
+            {
+                const std::uint32_t v = indices[triangle*3 + k];
+                output.push_back(v);
+                deadEndStack.push_back(v);
+                candidates.push_back(v);
+                liveCounts[v]--;
+                if (time - timestamps[v] > cacheSize)
+                    timestamps[v] = time++;
+            }
+            emitted[triangle] = true;
+        }
+
+        // Select the next fanning vertex among the 1-ring that will still be in cache once its triangles are emitted
+        std::uint32_t nextVertex = g_invalidIndex;
+        std::int64_t bestPriority = -1;
+        for (std::uint32_t v : candidates)
+        {
+            if (liveCounts[v] == 0)
+                continue;
+
+            std::int64_t priority = 0;
+            if (time - timestamps[v] + 2*liveCounts[v] <= cacheSize)
+                priority = time - timestamps[v];
+
+            if (priority > bestPriority)
+            {
+                bestPriority = priority;
+                nextVertex = v;
+            }
+        }
+
+        if (nextVertex == g_invalidIndex)
+        {
+            // Non-local jump; this is a hard boundary for the overdraw clusters
+            nextVertex = SkipDeadEnd();
+            if (nextVertex != g_invalidIndex)
+                clusters.push_back(static_cast<std::uint32_t>(output.size() / 3));
+        }
+
+        fanningVertex = nextVertex;
+    }
+
+    std::copy(output.begin(), output.end(), indices);
+
+    return clusters;
+}
+
+
+/*
+ * Overdraw
+ */
+
+struct TriangleCluster
+{
+    std::uint32_t   firstTriangle;
+    std::uint32_t   numTriangles;
+    float           sortKey;
+};
+
+// Splits the hard clusters at soft boundaries where the cluster's own ACMR is still within the threshold.
+static std::vector<TriangleCluster> SplitClusters(
+    const std::uint32_t*                indices,
+    std::size_t                         numIndices,
+    std::uint32_t                       numVertices,
+    const std::vector<std::uint32_t>&   clusters,
+    float                               threshold,
+    std::uint32_t                       cacheSize)
+{
+    constexpr std::uint32_t minClusterSize = 64;
+
+    const std::uint32_t numTriangles = static_cast<std::uint32_t>(numIndices / 3);
+    const float maxACMR = AnalyzeVertexCache(indices, numIndices, numVertices, cacheSize).acmr * threshold;
+
+    std::vector<TriangleCluster> splitClusters;
+    std::vector<std::uint32_t> timestamps(numVertices, 0);
+    std::uint32_t time = cacheSize + 1;
+
+    for (std::size_t i = 0; i < clusters.size(); ++i)
+    {
+        const std::uint32_t begin   = clusters[i];
+        const std::uint32_t end     = (i + 1 < clusters.size() ? clusters[i + 1] : numTriangles);
+
+        // Every cluster starts with a cold cache since it may be drawn in any order
+        time += cacheSize + 1;
+
+        std::uint32_t clusterBegin = begin;
+        std::uint32_t numMisses = 0;
+
+        for (std::uint32_t t = begin; t < end; ++t)
+        {
+            for (int k = 0; k < 3; ++k)
+            {
+                const std::uint32_t v = indices[t*3 + k];
+                if (time - timestamps[v] > cacheSize)
+                {
+                    timestamps[v] = time++;
+                    ++numMisses;
+                }
+            }
+
+            const std::uint32_t clusterSize = t + 1 - clusterBegin;
+            if (t + 1 < end && clusterSize >= minClusterSize && static_cast<float>(numMisses) / static_cast<float>(clusterSize) <= maxACMR)
+            {
+                splitClusters.push_back(TriangleCluster{ clusterBegin, clusterSize, 0.0f });
+                clusterBegin = t + 1;
+                numMisses = 0;
+                time += cacheSize + 1;
+            }
+        }
+
+        if (clusterBegin < end)
+            splitClusters.push_back(TriangleCluster{ clusterBegin, end - clusterBegin, 0.0f });
+    }
+
+    return splitClusters;
+}
+
+void OptimizeOverdraw(
+    std::uint32_t*                      indices,
+    std::size_t                         numIndices,
+    const Vertex*                       vertices,
+    std::uint32_t                       numVertices,
+    const std::vector<std::uint32_t>&   clusters,
+    float                               threshold,
+    std::uint32_t                       cacheSize)
+{
+    if (numIndices < 3 || clusters.empty())
+        return;
+
+    std::vector<TriangleCluster> splitClusters = SplitClusters(indices, numIndices, numVertices, clusters, threshold, cacheSize);
+    if (splitClusters.size() < 2)
+        return;
+
+    // Compute mesh centroid from all referenced vertices
+    float meshCenter[3] = { 0.0f, 0.0f, 0.0f };
+    for (std::size_t i = 0; i < numIndices; ++i)
+    {
+        const float* p = vertices[indices[i]].position;
+        meshCenter[0] += p[0];
+        meshCenter[1] += p[1];
+        meshCenter[2] += p[2];
+    }
+    for (float& c : meshCenter)
+        c /= static_cast<float>(numIndices);
+
+    // Clusters far out on the hull and facing outwards are likely to occlude others, so they are drawn first
+    for (TriangleCluster& cluster : splitClusters)
+    {
+        float clusterCenter[3] = { 0.0f, 0.0f, 0.0f };
+        float clusterNormal[3] = { 0.0f, 0.0f, 0.0f };
+        float clusterArea = 0.0f;
+
+        for (std::uint32_t t = cluster.firstTriangle; t < cluster.firstTriangle + cluster.numTriangles; ++t)
+        {
+            const std::uint32_t* triangle = &indices[t*3];
+
+            float normal[3];
+            TriangleNormal(vertices, triangle, normal);
+            const float area = std::sqrt(Dot3(normal, normal));
+
+            for (int k = 0; k < 3; ++k)
+            {
+                const float* p = vertices[triangle[k]].position;
+                clusterCenter[0] += p[0] * area;
+                clusterCenter[1] += p[1] * area;
+                clusterCenter[2] += p[2] * area;
+            }
+            clusterNormal[0] += normal[0];
+            clusterNormal[1] += normal[1];
+            clusterNormal[2] += normal[2];
+            clusterArea += area * 3.0f;
+        }
+
+        if (clusterArea > 0.0f)
+        {
+            for (float& c : clusterCenter)
+                c /= clusterArea;
+        }
+        Normalize3(clusterNormal);
+
+        float offset[3];
+        Sub3(clusterCenter, meshCenter, offset);
+        cluster.sortKey = Dot3(offset, clusterNormal);
+    }
+
+    std::stable_sort(
+        splitClusters.begin(), splitClusters.end(),
+        [](const TriangleCluster& lhs, const TriangleCluster& rhs) -> bool
+        {
+            return (lhs.sortKey > rhs.sortKey);
+        }
+    );
+
+    std::vector<std::uint32_t> output;
+    output.reserve(numIndices);
+    for (const TriangleCluster& cluster : splitClusters)
+        output.insert(output.end(), indices + cluster.firstTriangle*3, indices + (cluster.firstTriangle + cluster.numTriangles)*3);
+
+    std::copy(output.begin(), output.end(), indices);
+}
+
+
+/*
+ * Vertex fetch
+ */
+
+std::uint32_t OptimizeVertexFetch(Vertex* vertices, std::uint32_t numVertices, std::uint32_t* indices, std::size_t numIndices)
+{
+    std::vector<std::uint32_t> remap(numVertices, g_invalidIndex);
+    std::uint32_t numUsedVertices = 0;
+
+    for (std::size_t i = 0; i < numIndices; ++i)
+    {
+        std::uint32_t& newIndex = remap[indices[i]];
+        if (newIndex == g_invalidIndex)
+            newIndex = numUsedVertices++;
+        indices[i] = newIndex;
+    }
+
+    std::vector<Vertex> reordered(numUsedVertices);
+    for (std::uint32_t v = 0; v < numVertices; ++v)
+    {
+        if (remap[v] != g_invalidIndex)
+            reordered[remap[v]] = vertices[v];
+    }
+
+    std::copy(reordered.begin(), reordered.end(), vertices);
+
+    return numUsedVertices;
+}
+
+
+/*
+ * Meshlets
+ */
+
+static void ComputeMeshletBounds(Meshlet& meshlet, const MeshletBuffer& buffer, const Vertex* vertices)
+{
+    // Bounding sphere around the center of the bounding box
+    float minPos[3] = { +1e30f, +1e30f, +1e30f };
+    float maxPos[3] = { -1e30f, -1e30f, -1e30f };
+    for (std::uint32_t i = 0; i < meshlet.numVertices; ++i)
+    {
+        const float* p = vertices[buffer.vertices[meshlet.firstVertex + i]].position;
+        for (int k = 0; k < 3; ++k)
+        {
+            minPos[k] = std::min(minPos[k], p[k]);
+            maxPos[k] = std::max(maxPos[k], p[k]);
+        }
+    }
+    for (int k = 0; k < 3; ++k)
+        meshlet.center[k] = (minPos[k] + maxPos[k]) * 0.5f;
+
+    float radiusSq = 0.0f;
+    for (std::uint32_t i = 0; i < meshlet.numVertices; ++i)
+    {
+        float offset[3];
+        Sub3(vertices[buffer.vertices[meshlet.firstVertex + i]].position, meshlet.center, offset);
+        radiusSq = std::max(radiusSq, Dot3(offset, offset));
+    }
+    meshlet.radius = std::sqrt(radiusSq);
+
+    // Normal cone from the average triangle normal and the largest deviation from it
+    std::vector<float> normals(meshlet.numTriangles * 3);
+    float axis[3] = { 0.0f, 0.0f, 0.0f };
+    for (std::uint32_t t = 0; t < meshlet.numTriangles; ++t)
+    {
+        const std::uint8_t* localTriangle = &buffer.triangles[(meshlet.firstTriangle + t)*3];
+        const std::uint32_t triangle[3] =
+        {
+            buffer.vertices[meshlet.firstVertex + localTriangle[0]],
+            buffer.vertices[meshlet.firstVertex + localTriangle[1]],
+            buffer.vertices[meshlet.firstVertex + localTriangle[2]],
+        };
+        float* normal = &normals[t*3];
+        TriangleNormal(vertices, triangle, normal);
+        Normalize3(normal);
+        for (int k = 0; k < 3; ++k)
+            axis[k] += normal[k];
+    }
+
+    if (Normalize3(axis) <= 0.0f)
+    {
+        meshlet.coneCutoff = 1.0f;
+        return;
+    }
+
+    float minDot = 1.0f;
+    for (std::uint32_t t = 0; t < meshlet.numTriangles; ++t)
+        minDot = std::min(minDot, Dot3(axis, &normals[t*3]));
+
+    std::memcpy(meshlet.coneAxis, axis, sizeof(axis));
+    meshlet.coneCutoff = (minDot <= 0.0f ? 1.0f : std::sqrt(1.0f - minDot*minDot));
+}
+
+void BuildMeshlets(
+    MeshletBuffer&          outMeshlets,
+    const std::uint32_t*    indices,
+    std::size_t             numIndices,
+    const Vertex*           vertices,
+    std::uint32_t           numVertices,
+    std::uint32_t           maxVertices,
+    std::uint32_t           maxTriangles)
+{
+    outMeshlets.meshlets.clear();
+    outMeshlets.vertices.clear();
+    outMeshlets.triangles.clear();
+
+    maxVertices = std::min(maxVertices, 256u);
+
+    // Meshlet-local index of each global vertex in the current meshlet
+    std::vector<std::uint32_t> localIndices(numVertices, g_invalidIndex);
+
+    Meshlet meshlet;
+
+    auto FinishMeshlet = [&]()
+    {
+        if (meshlet.numTriangles == 0)
+            return;
+
+        ComputeMeshletBounds(meshlet, outMeshlets, vertices);
+        for (std::uint32_t i = 0; i < meshlet.numVertices; ++i)
+            localIndices[outMeshlets.vertices[meshlet.firstVertex + i]] = g_invalidIndex;
+
+        outMeshlets.meshlets.push_back(meshlet);
+
+        meshlet = Meshlet{};
+        meshlet.firstVertex     = static_cast<std::uint32_t>(outMeshlets.vertices.size());
+        meshlet.firstTriangle   = static_cast<std::uint32_t>(outMeshlets.triangles.size() / 3);
+    };
+
+    for (std::size_t i = 0; i + 2 < numIndices; i += 3)
+    {
+        const std::uint32_t* triangle = &indices[i];
+
+        std::uint32_t numNewVertices = 0;
+        for (int k = 0; k < 3; ++k)
+        {
+            const bool isDuplicate = (k > 0 && triangle[k] == triangle[0]) || (k > 1 && triangle[k] == triangle[1]);
+            if (localIndices[triangle[k]] == g_invalidIndex && !isDuplicate)
+                ++numNewVertices;
+        }
+
+        if (meshlet.numVertices + numNewVertices > maxVertices || meshlet.numTriangles + 1 > maxTriangles)
+            FinishMeshlet();
+
+        for (int k = 0; k < 3; ++k)
+        {
+            std::uint32_t& localIndex = localIndices[triangle[k]];
+            if (localIndex == g_invalidIndex)
+            {
+                localIndex = meshlet.numVertices++;
+                outMeshlets.vertices.push_back(triangle[k]);
+            }
+            outMeshlets.triangles.push_back(static_cast<std::uint8_t>(localIndex));
+        }
+        meshlet.numTriangles++;
+    }
+
+    FinishMeshlet();
+}
+
@@ -0,0 +1,83 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * MeshOptimizer.h
+ */
+
+#pragma once
+
+#include "MeshGenerator.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+struct VertexCacheStats
+{
+    float   acmr    = 0.0f; // Average cache miss ratio: transformed vertices per triangle (0.5 is optimal for large grids, 3 is worst)
+    float   atvr    = 0.0f; // Average transformed vertex ratio: transformed vertices per unique vertex (1 is optimal)
+};
+
+struct Meshlet
+{
+    std::uint32_t   firstVertex     = 0;    // Offset into MeshletBuffer::vertices
+    std::uint32_t   firstTriangle   = 0;    // Offset into MeshletBuffer::triangles in units of triangles
+    std::uint32_t   numVertices     = 0;
+    std::uint32_t   numTriangles    = 0;
+    float           center[3]       = {};   // Bounding sphere
+    float           radius          = 0.0f;
+    float           coneAxis[3]     = {};   // Normal cone; the meshlet is backfacing if dot(normalize(center - eye), coneAxis) >= coneCutoff
+    float           coneCutoff      = 1.0f; // Sine of the cone spread angle; 1 if the triangle normals spread over more than a hemisphere
+};
+
+struct MeshletBuffer
+{
+    std::vector<Meshlet>        meshlets;
+    std::vector<std::uint32_t>  vertices;   // Global vertex indices referenced by the meshlets
+    std::vector<std::uint8_t>   triangles;  // Three meshlet-local vertex indices per triangle
+};
+
+struct MeshOptimizerStats
+{
+    VertexCacheStats    before;
+    VertexCacheStats    after;
+    std::uint32_t       numClusters     = 0;
+    std::uint32_t       numMeshlets     = 0;
+    float               optimizeTime    = 0.0f; // CPU time in seconds
+};
+
+// Simulates a FIFO post-transform vertex cache of the specified size.
+VertexCacheStats AnalyzeVertexCache(const std::uint32_t* indices, std::size_t numIndices, std::uint32_t numVertices, std::uint32_t cacheSize = 32);
+
+// Reorders triangles for post-transform vertex cache locality with the Tipsify algorithm (Sander et al. 2007).
+// Returns the first triangle index of each cluster, i.e. each position where the algorithm jumped to a non-local vertex.
+std::vector<std::uint32_t> OptimizeVertexCache(std::uint32_t* indices, std::size_t numIndices, std::uint32_t numVertices, std::uint32_t cacheSize = 32);
+
+// Reorders the clusters from OptimizeVertexCache() so outward facing clusters on the hull are drawn first to reduce overdraw.
+// Clusters are split further wherever the cache miss ratio so far stays within 'threshold' times the mesh average.
+void OptimizeOverdraw(
+    std::uint32_t*                      indices,
+    std::size_t                         numIndices,
+    const Vertex*                       vertices,
+    std::uint32_t                       numVertices,
+    const std::vector<std::uint32_t>&   clusters,
+    float                               threshold   = 1.05f,
+    std::uint32_t                       cacheSize   = 32
+);
+
+// Reorders vertices in the order of first use by the index buffer and drops unused vertices. Returns the new number of vertices.
+std::uint32_t OptimizeVertexFetch(Vertex* vertices, std::uint32_t numVertices, std::uint32_t* indices, std::size_t numIndices);
+
+// Splits the triangles into meshlets with bounding spheres and normal cones.
+void BuildMeshlets(
+    MeshletBuffer&          outMeshlets,
+    const std::uint32_t*    indices,
+    std::size_t             numIndices,
+    const Vertex*           vertices,
+    std::uint32_t           numVertices,
+    std::uint32_t           maxVertices     = 64,
+    std::uint32_t           maxTriangles    = 124
+);
+
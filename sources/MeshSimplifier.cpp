@@ -0,0 +1,490 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * MeshSimplifier.cpp
+ */
+
+#include "MeshSimplifier.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+
+
+static constexpr std::uint32_t g_invalidIndex = 0xFFFFFFFFu;
+
+// LODs with fewer triangles are not worth a separate draw range
+static constexpr std::size_t g_minLodTriangles = 32;
+
+// A LOD must have at most this fraction of the triangles of the previous one; otherwise the chain ends
+static constexpr float g_minLodReduction = 0.9f;
+
+static void Sub3(const float* a, const float* b, float* out)
+{
+    out[0] = a[0] - b[0];
+    out[1] = a[1] - b[1];
+    out[2] = a[2] - b[2];
+}
+
+static void Cross3(const float* a, const float* b, float* out)
+{
+    out[0] = a[1]*b[2] - a[2]*b[1];
+    out[1] = a[2]*b[0] - a[0]*b[2];
+    out[2] = a[0]*b[1] - a[1]*b[0];
+}
+
+static float Dot3(const float* a, const float* b)
+{
+    return a[0]*b[0] + a[1]*b[1] + a[2]*b[2];
+}
+
+static void TriangleNormal(const float* p0, const float* p1, const float* p2, float* outNormal)
+{
+    float e1[3], e2[3];
+    Sub3(p1, p0, e1);
+    Sub3(p2, p0, e2);
+    Cross3(e1, e2, outNormal);
+}
+
+
+/*
+ * Quadrics
+ */
+
+// Symmetric 4x4 matrix of the squared distances to a set of planes
+struct Quadric
+{
+    double xx = 0.0, xy = 0.0, xz = 0.0, xw = 0.0;
+    double yy = 0.0, yz = 0.0, yw = 0.0;
+    double zz = 0.0, zw = 0.0;
+    double ww = 0.0;
+};
+
+// Adds the plane through the triangle; degenerate triangles have no plane
+static void AddTriangleQuadric(Quadric& q, const float* p0, const float* p1, const float* p2)
+{
+    float normal[3];
+    TriangleNormal(p0, p1, p2, normal);
+
+    const double length = std::sqrt(static_cast<double>(Dot3(normal, normal)));
+    if (length == 0.0)
+        return;
+
+    const double a = normal[0] / length;
+    const double b = normal[1] / length;
+    const double c = normal[2] / length;
+    const double d = -(a*p0[0] + b*p0[1] + c*p0[2]);
+
+    q.xx += a*a; q.xy += a*b; q.xz += a*c; q.xw += a*d;
+    q.yy += b*b; q.yz += b*c; q.yw += b*d;
+    q.zz += c*c; q.zw += c*d;
+    q.ww += d*d;
+}
+
+static void AddQuadric(Quadric& dst, const Quadric& src)
+{
+    dst.xx += src.xx; dst.xy += src.xy; dst.xz += src.xz; dst.xw += src.xw;
+    dst.yy += src.yy; dst.yz += src.yz; dst.yw += src.yw;
+    dst.zz += src.zz; dst.zw += src.zw;
+    dst.ww += src.ww;
+}
+
+// Returns the sum of squared distances of the point to all planes of the quadric
+static double EvaluateQuadric(const Quadric& q, const float* p)
+{
+    const double x = p[0], y = p[1], z = p[2];
+    const double error =
+    (
+        q.xx*x*x + 2.0*q.xy*x*y + 2.0*q.xz*x*z + 2.0*q.xw*x +
+        q.yy*y*y + 2.0*q.yz*y*z + 2.0*q.yw*y +
+        q.zz*z*z + 2.0*q.zw*z +
+        q.ww
+    );
+    return std::max(0.0, error);
+}
+
+
+/*
+ * Topology
+ */
+
+static std::uint32_t HashPosition(const float* position)
+{
+    std::uint32_t bits[3];
+    std::memcpy(bits, position, sizeof(bits));
+    return (bits[0] * 73856093u) ^ (bits[1] * 19349663u) ^ (bits[2] * 83492791u);
+}
+
+// Maps each vertex to the first vertex with the same position, so vertices that only differ in their attributes are connected
+static std::vector<std::uint32_t> WeldPositions(const Vertex* vertices, std::uint32_t numVertices)
+{
+    std::size_t tableSize = 1;
+    while (tableSize < static_cast<std::size_t>(numVertices) * 2)
+        tableSize <<= 1;
+
+    std::vector<std::uint32_t> table(tableSize, g_invalidIndex);
+    std::vector<std::uint32_t> remap(numVertices);
+
+    for (std::uint32_t v = 0; v < numVertices; ++v)
+    {
+        // Adding zero turns negative zeros into positive ones, so both hash to the same slot
+        const float position[3] = { vertices[v].position[0] + 0.0f, vertices[v].position[1] + 0.0f, vertices[v].position[2] + 0.0f };
+
+        std::size_t slot = HashPosition(position) & (tableSize - 1);
+        for (; table[slot] != g_invalidIndex; slot = (slot + 1) & (tableSize - 1))
+        {
+            const float* other = vertices[table[slot]].position;
+            if (other[0] == position[0] && other[1] == position[1] && other[2] == position[2])
+                break;
+        }
+
+        if (table[slot] == g_invalidIndex)
+            table[slot] = v;
+        remap[v] = table[slot];
+    }
+
+    return remap;
+}
+
+// Returns which vertices must not be collapsed: vertices on attribute seams and on borders of the welded mesh
+static std::vector<bool> FindLockedVertices(
+    const std::uint32_t*                indices,
+    std::size_t                         numIndices,
+    std::uint32_t                       numVertices,
+    const std::vector<std::uint32_t>&   remap)
+{
+    std::vector<std::uint32_t> numWedges(numVertices, 0);
+    for (std::uint32_t v = 0; v < numVertices; ++v)
+        ++numWedges[remap[v]];
+
+    // Directed edges of the welded mesh, grouped by their start vertex
+    std::vector<std::uint32_t> edgeOffsets(static_cast<std::size_t>(numVertices) + 1, 0);
+    for (std::size_t i = 0; i < numIndices; ++i)
+        ++edgeOffsets[remap[indices[i]] + 1];
+    for (std::uint32_t v = 0; v < numVertices; ++v)
+        edgeOffsets[v + 1] += edgeOffsets[v];
+
+    std::vector<std::uint32_t> edgeEnds(numIndices);
+    std::vector<std::uint32_t> edgeCounts(numVertices, 0);
+    for (std::size_t i = 0; i < numIndices; ++i)
+    {
+        const std::uint32_t a = remap[indices[i]];
+        const std::uint32_t b = remap[indices[i - i % 3 + (i % 3 + 1) % 3]];
+        edgeEnds[edgeOffsets[a] + edgeCounts[a]++] = b;
+    }
+
+    // An edge without its opposite edge is on a border
+    std::vector<bool> isWeldedLocked(numVertices, false);
+    for (std::uint32_t a = 0; a < numVertices; ++a)
+    {
+        for (std::uint32_t i = edgeOffsets[a]; i < edgeOffsets[a + 1]; ++i)
+        {
+            const std::uint32_t b = edgeEnds[i];
+            const std::uint32_t* first = edgeEnds.data() + edgeOffsets[b];
+            const std::uint32_t* last = edgeEnds.data() + edgeOffsets[b + 1];
+            if (std::find(first, last, a) == last)
+            {
+                isWeldedLocked[a] = true;
+                isWeldedLocked[b] = true;
+            }
+        }
+    }
+
+    std::vector<bool> isLocked(numVertices);
+    for (std::uint32_t v = 0; v < numVertices; ++v)
+        isLocked[v] = (numWedges[remap[v]] > 1 || isWeldedLocked[remap[v]]);
+
+    return isLocked;
+}
+
+
+/*
+ * Simplification
+ */
+
+struct EdgeCollapse
+{
+    double          error   = 0.0;  // Squared error of the collapse
+    std::uint32_t   from    = 0;
+    std::uint32_t   to      = 0;
+};
+
+// Returns false if moving 'from' onto 'to' would flip or degenerate any triangle around 'from' that is not removed by the collapse
+static bool IsCollapseValid(
+    const std::uint32_t*    triangles,
+    const std::uint32_t*    adjacentBegin,
+    const std::uint32_t*    adjacentEnd,
+    const Vertex*           vertices,
+    std::uint32_t           from,
+    std::uint32_t           to)
+{
+    for (const std::uint32_t* it = adjacentBegin; it != adjacentEnd; ++it)
+    {
+        const std::uint32_t* triangle = triangles + static_cast<std::size_t>(*it) * 3;
+        if (triangle[0] == to || triangle[1] == to || triangle[2] == to)
+            continue;
+
+        const float* p[3];
+        const float* q[3];
+        for (int i = 0; i < 3; ++i)
+        {
+            p[i] = vertices[triangle[i]].position;
+            q[i] = vertices[triangle[i] == from ? to : triangle[i]].position;
+        }
+
+        float oldNormal[3], newNormal[3];
+        TriangleNormal(p[0], p[1], p[2], oldNormal);
+        TriangleNormal(q[0], q[1], q[2], newNormal);
+        if (Dot3(oldNormal, newNormal) <= 0.0f)
+            return false;
+    }
+    return true;
+}
+
+std::size_t SimplifyMesh(
+    std::uint32_t*          outIndices,
+    const std::uint32_t*    indices,
+    std::size_t             numIndices,
+    const Vertex*           vertices,
+    std::uint32_t           numVertices,
+    std::size_t             targetNumIndices,
+    float                   maxError,
+    float*                  outError)
+{
+    const std::size_t numTriangles = numIndices / 3;
+
+    std::vector<std::uint32_t> triangles(indices, indices + numTriangles * 3);
+    std::vector<bool> isTriangleAlive(numTriangles, true);
+    std::size_t numAliveTriangles = numTriangles;
+
+    const std::vector<std::uint32_t> remap = WeldPositions(vertices, numVertices);
+    const std::vector<bool> isLocked = FindLockedVertices(triangles.data(), triangles.size(), numVertices, remap);
+
+    // Quadrics are accumulated per welded vertex, so a collapse onto a seam vertex keeps the error of all its wedges
+    std::vector<Quadric> quadrics(numVertices);
+    for (std::size_t t = 0; t < numTriangles; ++t)
+    {
+        const std::uint32_t* triangle = &triangles[t * 3];
+        for (int i = 0; i < 3; ++i)
+        {
+            AddTriangleQuadric(
+                quadrics[remap[triangle[i]]],
+                vertices[triangle[0]].position,
+                vertices[triangle[1]].position,
+                vertices[triangle[2]].position
+            );
+        }
+    }
+
+    const double maxSquaredError = static_cast<double>(maxError) * static_cast<double>(maxError);
+    double maxCollapseError = 0.0;
+
+    std::vector<std::uint32_t> adjacentOffsets(static_cast<std::size_t>(numVertices) + 1);
+    std::vector<std::uint32_t> adjacentTriangles;
+    std::vector<std::uint32_t> adjacentCounts(numVertices);
+    std::vector<bool> isTouched(numVertices);
+    std::vector<EdgeCollapse> collapses;
+
+    // Each pass collapses the cheapest edges whose neighborhoods have not been changed by another collapse of the same pass,
+    // so the adjacency and the validity checks stay exact without maintaining a priority queue
+    while (numAliveTriangles * 3 > targetNumIndices)
+    {
+        std::fill(adjacentOffsets.begin(), adjacentOffsets.end(), 0u);
+        for (std::size_t t = 0; t < numTriangles; ++t)
+        {
+            if (isTriangleAlive[t])
+            {
+                for (int i = 0; i < 3; ++i)
+                    ++adjacentOffsets[triangles[t * 3 + i] + 1];
+            }
+        }
+        for (std::uint32_t v = 0; v < numVertices; ++v)
+            adjacentOffsets[v + 1] += adjacentOffsets[v];
+
+        adjacentTriangles.resize(adjacentOffsets[numVertices]);
+        std::fill(adjacentCounts.begin(), adjacentCounts.end(), 0u);
+        collapses.clear();
+
+        for (std::size_t t = 0; t < numTriangles; ++t)
+        {
+            if (!isTriangleAlive[t])
+                continue;
+
+            const std::uint32_t* triangle = &triangles[t * 3];
+            for (int i = 0; i < 3; ++i)
+            {
+                const std::uint32_t a = triangle[i];
+                const std::uint32_t b = triangle[(i + 1) % 3];
+                adjacentTriangles[adjacentOffsets[a] + adjacentCounts[a]++] = static_cast<std::uint32_t>(t);
+
+                // Interior edges appear once in each direction, so they are only taken from one of their two triangles
+                if (a > b)
+                    continue;
+
+                EdgeCollapse collapse;
+                if (!isLocked[a])
+                {
+                    collapse.error  = EvaluateQuadric(quadrics[remap[a]], vertices[b].position);
+                    collapse.from   = a;
+                    collapse.to     = b;
+                    collapses.push_back(collapse);
+                }
+                if (!isLocked[b])
+                {
+                    collapse.error  = EvaluateQuadric(quadrics[remap[b]], vertices[a].position);
+                    collapse.from   = b;
+                    collapse.to     = a;
+                    collapses.push_back(collapse);
+                }
+            }
+        }
+
+        std::sort(
+            collapses.begin(), collapses.end(),
+            [](const EdgeCollapse& lhs, const EdgeCollapse& rhs)
+            {
+                return (lhs.error < rhs.error);
+            }
+        );
+
+        std::fill(isTouched.begin(), isTouched.end(), false);
+        std::size_t numCollapsed = 0;
+
+        for (const EdgeCollapse& collapse : collapses)
+        {
+            if (numAliveTriangles * 3 <= targetNumIndices || collapse.error > maxSquaredError)
+                break;
+            if (isTouched[collapse.from] || isTouched[collapse.to])
+                continue;
+
+            const std::uint32_t* adjacentBegin = adjacentTriangles.data() + adjacentOffsets[collapse.from];
+            const std::uint32_t* adjacentEnd = adjacentTriangles.data() + adjacentOffsets[collapse.from + 1];
+            if (!IsCollapseValid(triangles.data(), adjacentBegin, adjacentEnd, vertices, collapse.from, collapse.to))
+                continue;
+
+            // Move all triangles onto the target vertex; the triangles that contained the edge degenerate and are removed
+            for (const std::uint32_t* it = adjacentBegin; it != adjacentEnd; ++it)
+            {
+                std::uint32_t* triangle = &triangles[static_cast<std::size_t>(*it) * 3];
+                for (int i = 0; i < 3; ++i)
+                {
+                    isTouched[triangle[i]] = true;
+                    if (triangle[i] == collapse.from)
+                        triangle[i] = collapse.to;
+                }
+                if (triangle[0] == triangle[1] || triangle[1] == triangle[2] || triangle[2] == triangle[0])
+                {
+                    isTriangleAlive[*it] = false;
+                    --numAliveTriangles;
+                }
+            }
+
+            AddQuadric(quadrics[remap[collapse.to]], quadrics[remap[collapse.from]]);
+            maxCollapseError = std::max(maxCollapseError, collapse.error);
+            ++numCollapsed;
+        }
+
+        if (numCollapsed == 0)
+            break;
+    }
+
+    std::size_t numOutIndices = 0;
+    for (std::size_t t = 0; t < numTriangles; ++t)
+    {
+        if (isTriangleAlive[t])
+        {
+            outIndices[numOutIndices++] = triangles[t * 3 + 0];
+            outIndices[numOutIndices++] = triangles[t * 3 + 1];
+            outIndices[numOutIndices++] = triangles[t * 3 + 2];
+        }
+    }
+
+    if (outError != nullptr)
+        *outError = static_cast<float>(std::sqrt(maxCollapseError));
+
+    return numOutIndices;
+}
+
+
+/*
+ * Levels of detail
+ */
+
+std::vector<MeshLod> BuildMeshLods(
+    std::vector<std::uint32_t>& indices,
+    const Vertex*               vertices,
+    std::uint32_t               numVertices,
+    std::uint32_t               maxLods,
+    float                       reduction)
+{
+    std::vector<MeshLod> lods;
+
+    MeshLod fullMesh;
+    {
+        fullMesh.firstIndex = 0;
+        fullMesh.numIndices = static_cast<std::uint32_t>(indices.size());
+    }
+    lods.push_back(fullMesh);
+
+    std::vector<std::uint32_t> lodIndices;
+
+    while (lods.size() < maxLods)
+    {
+        const MeshLod prevLod = lods.back();
+        const std::size_t targetNumIndices = static_cast<std::size_t>(static_cast<float>(prevLod.numIndices / 3) * reduction) * 3;
+        if (targetNumIndices < g_minLodTriangles * 3)
+            break;
+
+        lodIndices.resize(prevLod.numIndices);
+        float error = 0.0f;
+        const std::size_t numIndices = SimplifyMesh(
+            lodIndices.data(),
+            indices.data() + prevLod.firstIndex,
+            prevLod.numIndices,
+            vertices,
+            numVertices,
+            targetNumIndices,
+            FLT_MAX,
+            &error
+        );
+
+        // Mostly locked meshes, e.g. a cube without tessellation, cannot be reduced any further
+        if (static_cast<float>(numIndices) > static_cast<float>(prevLod.numIndices) * g_minLodReduction)
+            break;
+
+        // Errors of successive simplifications add up, since each one starts from the previous LOD
+        MeshLod lod;
+        {
+            lod.firstIndex  = static_cast<std::uint32_t>(indices.size());
+            lod.numIndices  = static_cast<std::uint32_t>(numIndices);
+            lod.error       = prevLod.error + error;
+        }
+        indices.insert(indices.end(), lodIndices.begin(), lodIndices.begin() + static_cast<std::ptrdiff_t>(numIndices));
+        lods.push_back(lod);
+    }
+
+    return lods;
+}
+
+std::uint32_t SelectMeshLod(
+    const std::vector<MeshLod>& lods,
+    std::uint32_t               currentLod,
+    float                       pixelsPerUnit,
+    float                       maxPixelError,
+    float                       hysteresis)
+{
+    if (lods.empty())
+        return 0;
+
+    std::uint32_t lod = std::min(currentLod, static_cast<std::uint32_t>(lods.size() - 1));
+
+    while (lod + 1 < lods.size() && lods[lod + 1].error * pixelsPerUnit <= maxPixelError * (1.0f - hysteresis))
+        ++lod;
+    while (lod > 0 && lods[lod].error * pixelsPerUnit > maxPixelError * (1.0f + hysteresis))
+        --lod;
+
+    return lod;
+}
+
@@ -0,0 +1,61 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * MeshSimplifier.h
+ */
+
+#pragma once
+
+#include "MeshGenerator.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+// Range of a level of detail in an index buffer that holds all LODs of a mesh one after another
+struct MeshLod
+{
+    std::uint32_t   firstIndex  = 0;
+    std::uint32_t   numIndices  = 0;
+    float           error       = 0.0f; // Upper bound of the deviation from the full mesh in object space units; zero for the full mesh
+};
+
+// Simplifies the triangle list with quadric error metrics (Garland and Heckbert 1997) by collapsing edges in order of their error
+// until at most 'targetNumIndices' are left or no edge can be collapsed within 'maxError'. Vertices only collapse onto other
+// vertices, so the result references a subset of the input vertices. Vertices on borders and attribute seams, i.e. vertices that
+// share their position with other vertices, are locked. Writes up to 'numIndices' indices to 'outIndices' and returns their number.
+std::size_t SimplifyMesh(
+    std::uint32_t*          outIndices,
+    const std::uint32_t*    indices,
+    std::size_t             numIndices,
+    const Vertex*           vertices,
+    std::uint32_t           numVertices,
+    std::size_t             targetNumIndices,
+    float                   maxError,
+    float*                  outError        = nullptr
+);
+
+// Appends a chain of LODs to the index buffer, which must contain the full mesh. Each LOD is simplified from the previous one
+// to about 'reduction' times its triangles. Stops after 'maxLods' or once the mesh cannot be reduced any further.
+// Returns the ranges of all LODs in 'indices', starting with the full mesh.
+std::vector<MeshLod> BuildMeshLods(
+    std::vector<std::uint32_t>& indices,
+    const Vertex*               vertices,
+    std::uint32_t               numVertices,
+    std::uint32_t               maxLods     = 6,
+    float                       reduction   = 0.5f
+);
+
+// Returns the coarsest LOD whose error projects to at most 'maxPixelError' pixels, where 'pixelsPerUnit' is the projected size
+// of one object space unit. Starting from 'currentLod', a coarser LOD is only taken below (1 - hysteresis) times the maximum
+// error and a finer LOD only above (1 + hysteresis) times the maximum error, so objects near a threshold do not flicker.
+std::uint32_t SelectMeshLod(
+    const std::vector<MeshLod>& lods,
+    std::uint32_t               currentLod,
+    float                       pixelsPerUnit,
+    float                       maxPixelError,
+    float                       hysteresis
+);
+
@@ -0,0 +1,347 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * MetricsExporter.cpp
+ */
+
+#include "MetricsExporter.h"
+#include "MemoryTracker.h"
+#include <LLGL/Log.h>
+#include <algorithm>
+#include <new>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef _WIN32
+#   include <Windows.h>
+#else
+#   include <sys/mman.h>
+#   include <sys/socket.h>
+#   include <sys/un.h>
+#   include <fcntl.h>
+#   include <poll.h>
+#   include <unistd.h>
+#endif
+
+#if !defined _WIN32 && !defined MSG_NOSIGNAL
+#   define MSG_NOSIGNAL 0 // SIGPIPE is suppressed per socket with SO_NOSIGPIPE instead
+#endif
+
+
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "Shared-memory ring buffer requires lock-free 64-bit atomics");
+
+// Time in milliseconds the socket thread waits for a connection before it checks whether to stop
+static constexpr int g_socketPollTimeout = 100;
+
+MetricsExporter& MetricsExporter::Get()
+{
+    static MetricsExporter instance;
+    return instance;
+}
+
+MetricsExporter::~MetricsExporter()
+{
+    Close();
+}
+
+bool MetricsExporter::CreateRing(std::uint32_t capacity, void* memory)
+{
+    header  = new (memory) MetricsRingHeader;
+    records = reinterpret_cast<MetricsRecord*>(header + 1);
+
+    header->magic       = MetricsExporter::magic;
+    header->version     = MetricsExporter::version;
+    header->capacity    = capacity;
+    header->recordSize  = sizeof(MetricsRecord);
+    header->writeIndex.store(0, std::memory_order_relaxed);
+
+    for (std::uint32_t i = 0; i < capacity; ++i)
+        new (&records[i]) MetricsRecord{};
+
+    return true;
+}
+
+bool MetricsExporter::OpenSharedMemory(const char* name, std::uint32_t capacity)
+{
+    if (IsEnabled() || capacity == 0)
+        return false;
+
+    mappingSize = sizeof(MetricsRingHeader) + sizeof(MetricsRecord) * capacity;
+
+    #ifdef _WIN32
+
+    HANDLE mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0, static_cast<DWORD>(mappingSize), name);
+    if (mapping == nullptr)
+    {
+        LLGL::Log::Errorf(LLGL::Log::ColorFlags::StdError, "Failed to create shared memory for metrics: %s\n", name);
+        return false;
+    }
+
+    void* memory = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, mappingSize);
+    if (memory == nullptr)
+    {
+        CloseHandle(mapping);
+        LLGL::Log::Errorf(LLGL::Log::ColorFlags::StdError, "Failed to map shared memory for metrics: %s\n", name);
+        return false;
+    }
+    mappingHandle = mapping;
+
+    #else
+
+    const int fd = shm_open(name, O_CREAT | O_RDWR, 0644);
+    if (fd == -1)
+    {
+        LLGL::Log::Errorf(LLGL::Log::ColorFlags::StdError, "Failed to create shared memory for metrics: %s\n", name);
+        return false;
+    }
+
+    if (ftruncate(fd, static_cast<off_t>(mappingSize)) == -1)
+    {
+        close(fd);
+        shm_unlink(name);
+        LLGL::Log::Errorf(LLGL::Log::ColorFlags::StdError, "Failed to resize shared memory for metrics: %s\n", name);
+        return false;
+    }
+
+    void* memory = mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (memory == MAP_FAILED)
+    {
+        shm_unlink(name);
+        LLGL::Log::Errorf(LLGL::Log::ColorFlags::StdError, "Failed to map shared memory for metrics: %s\n", name);
+        return false;
+    }
+
+    #endif
+
+    sharedMemory        = memory;
+    sharedMemoryName    = name;
+
+    return CreateRing(capacity, memory);
+}
+
+bool MetricsExporter::OpenSocket(const char* path)
+{
+    if (socketFd != -1)
+        return false;
+
+    #ifdef _WIN32
+
+    LLGL::Log::Errorf(LLGL::Log::ColorFlags::StdError, "Metrics socket is not supported on this platform: %s\n", path);
+    return false;
+
+    #else
+
+    sockaddr_un addr = {};
+    addr.sun_family = AF_UNIX;
+    if (std::strlen(path) >= sizeof(addr.sun_path))
+    {
+        LLGL::Log::Errorf(LLGL::Log::ColorFlags::StdError, "Metrics socket path is too long: %s\n", path);
+        return false;
+    }
+    std::strcpy(addr.sun_path, path);
+
+    const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd == -1)
+        return false;
+
+    // Remove the socket file of a previous run that did not shut down
+    unlink(path);
+
+    if (bind(fd, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) == -1 || listen(fd, 4) == -1)
+    {
+        close(fd);
+        LLGL::Log::Errorf(LLGL::Log::ColorFlags::StdError, "Failed to listen on metrics socket: %s\n", path);
+        return false;
+    }
+
+    // Metrics are always served from the ring buffer, so allocate one in process memory if there is no shared memory
+    if (!IsEnabled())
+    {
+        constexpr std::uint32_t localCapacity = 64;
+        mappingSize = sizeof(MetricsRingHeader) + sizeof(MetricsRecord) * localCapacity;
+        localMemory = std::calloc(1, mappingSize);
+        CreateRing(localCapacity, localMemory);
+    }
+
+    socketFd    = fd;
+    socketPath  = path;
+
+    isSocketServing.store(true);
+    socketThread = std::thread(&MetricsExporter::ServeSocket, this);
+
+    return true;
+
+    #endif
+}
+
+void MetricsExporter::Close()
+{
+    #ifndef _WIN32
+
+    if (socketThread.joinable())
+    {
+        isSocketServing.store(false);
+        socketThread.join();
+    }
+
+    if (socketFd != -1)
+    {
+        close(socketFd);
+        unlink(socketPath.c_str());
+        socketFd = -1;
+    }
+
+    #endif
+
+    if (sharedMemory != nullptr)
+    {
+        #ifdef _WIN32
+        UnmapViewOfFile(sharedMemory);
+        CloseHandle(mappingHandle);
+        mappingHandle = nullptr;
+        #else
+        munmap(sharedMemory, mappingSize);
+        shm_unlink(sharedMemoryName.c_str());
+        #endif
+        sharedMemory = nullptr;
+    }
+
+    std::free(localMemory);
+    localMemory = nullptr;
+
+    header  = nullptr;
+    records = nullptr;
+}
+
+void MetricsExporter::Publish(const FrameMetrics& metrics)
+{
+    if (header == nullptr)
+        return;
+
+    // Only the render loop writes, so the write index can be read relaxed
+    const std::uint64_t index = header->writeIndex.load(std::memory_order_relaxed);
+    MetricsRecord& record = records[index % header->capacity];
+
+    record.sequence.store(index * 2 + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    {
+        std::memcpy(&record.metrics, &metrics, sizeof(FrameMetrics));
+    }
+    record.sequence.store(index * 2 + 2, std::memory_order_release);
+
+    header->writeIndex.store(index + 1, std::memory_order_release);
+}
+
+// Appends a Prometheus gauge with one sample per window
+template <typename TGetValue>
+static void AppendGauge(std::string& text, const char* name, const char* help, const FrameMetrics* latest, const bool* hasWindow, TGetValue getValue)
+{
+    char line[256];
+
+    std::snprintf(line, sizeof(line), "# HELP %s %s\n# TYPE %s gauge\n", name, help, name);
+    text += line;
+
+    for (int i = 0; i < MemoryTracker::maxWindows; ++i)
+    {
+        if (hasWindow[i])
+        {
+            std::snprintf(line, sizeof(line), "%s{window=\"%d\"} %.9g\n", name, i, getValue(latest[i]));
+            text += line;
+        }
+    }
+}
+
+std::string MetricsExporter::FormatPrometheusText() const
+{
+    FrameMetrics latest[MemoryTracker::maxWindows];
+    bool hasWindow[MemoryTracker::maxWindows] = {};
+
+    // Walk backwards from the newest record until the latest metrics of every window have been found
+    const std::uint64_t writeIndex = header->writeIndex.load(std::memory_order_acquire);
+    const std::uint64_t numRecords = std::min<std::uint64_t>(writeIndex, header->capacity);
+
+    for (std::uint64_t i = 0; i < numRecords; ++i)
+    {
+        const std::uint64_t index = writeIndex - 1 - i;
+        const MetricsRecord& record = records[index % header->capacity];
+
+        FrameMetrics metrics;
+        const std::uint64_t sequenceBefore = record.sequence.load(std::memory_order_acquire);
+        std::memcpy(&metrics, &record.metrics, sizeof(FrameMetrics));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const std::uint64_t sequenceAfter = record.sequence.load(std::memory_order_relaxed);
+
+        // The writer has lapped this reader, so all older records are overwritten as well
+        if (sequenceBefore != sequenceAfter || sequenceBefore != index * 2 + 2)
+            break;
+
+        if (metrics.windowIndex < static_cast<std::uint32_t>(MemoryTracker::maxWindows) && !hasWindow[metrics.windowIndex])
+        {
+            latest[metrics.windowIndex]     = metrics;
+            hasWindow[metrics.windowIndex]  = true;
+        }
+    }
+
+    std::string text;
+
+    AppendGauge(text, "llgl_example_frame_index", "Index of the last published frame.", latest, hasWindow, [](const FrameMetrics& m) { return static_cast<double>(m.frameIndex); });
+    AppendGauge(text, "llgl_example_frame_time_seconds", "CPU time between the last two frames.", latest, hasWindow, [](const FrameMetrics& m) { return static_cast<double>(m.frameTime); });
+    AppendGauge(text, "llgl_example_render_time_seconds", "CPU time to encode, submit, and present the window.", latest, hasWindow, [](const FrameMetrics& m) { return static_cast<double>(m.renderTime); });
+    AppendGauge(text, "llgl_example_present_time_seconds", "CPU time spent presenting the window.", latest, hasWindow, [](const FrameMetrics& m) { return static_cast<double>(m.presentTime); });
+    AppendGauge(text, "llgl_example_draw_calls", "Draw calls of the window in the last frame.", latest, hasWindow, [](const FrameMetrics& m) { return static_cast<double>(m.numDrawCalls); });
+    AppendGauge(text, "llgl_example_upload_bytes", "Bytes uploaded to the constant buffer in the last frame.", latest, hasWindow, [](const FrameMetrics& m) { return static_cast<double>(m.uploadBytes); });
+    AppendGauge(text, "llgl_example_memory_bytes", "Live bytes of the resources and heap allocations of the window.", latest, hasWindow, [](const FrameMetrics& m) { return static_cast<double>(m.memoryBytes); });
+    AppendGauge(text, "llgl_example_total_memory_bytes", "Live bytes of all tracked resources and heap allocations.", latest, hasWindow, [](const FrameMetrics& m) { return static_cast<double>(m.totalMemoryBytes); });
+
+    return text;
+}
+
+void MetricsExporter::ServeSocket()
+{
+    #ifndef _WIN32
+
+    while (isSocketServing.load())
+    {
+        pollfd listenPoll = { socketFd, POLLIN, 0 };
+        if (poll(&listenPoll, 1, g_socketPollTimeout) <= 0)
+            continue;
+
+        const int clientFd = accept(socketFd, nullptr, nullptr);
+        if (clientFd == -1)
+            continue;
+
+        #ifdef SO_NOSIGPIPE
+        const int noSigPipe = 1;
+        setsockopt(clientFd, SOL_SOCKET, SO_NOSIGPIPE, &noSigPipe, sizeof(noSigPipe));
+        #endif
+
+        // Scrapers send an HTTP request first; its content is irrelevant, since there is only one resource
+        pollfd clientPoll = { clientFd, POLLIN, 0 };
+        if (poll(&clientPoll, 1, g_socketPollTimeout) > 0)
+        {
+            char request[1024];
+            (void)recv(clientFd, request, sizeof(request), 0);
+        }
+
+        const std::string body = FormatPrometheusText();
+
+        char responseHeader[128];
+        const int headerLen = std::snprintf(
+            responseHeader, sizeof(responseHeader),
+            "HTTP/1.0 200 OK\r\nContent-Type: text/plain; version=0.0.4\r\nContent-Length: %zu\r\n\r\n",
+            body.size()
+        );
+
+        (void)send(clientFd, responseHeader, static_cast<std::size_t>(headerLen), MSG_NOSIGNAL);
+        (void)send(clientFd, body.data(), body.size(), MSG_NOSIGNAL);
+
+        close(clientFd);
+    }
+
+    #endif
+}
+
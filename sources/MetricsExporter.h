@@ -0,0 +1,107 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * MetricsExporter.h
+ */
+
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <cstdint>
+
+
+// Metrics of a single window in a single frame. The layout is shared with external readers of the ring buffer.
+struct FrameMetrics
+{
+    std::uint64_t   frameIndex          = 0;
+    std::uint32_t   windowIndex         = 0;
+    std::uint32_t   numDrawCalls        = 0;    // Scene, upscale and ImGui draw commands
+    float           frameTime           = 0.0f; // CPU time in seconds between the last two frames
+    float           renderTime          = 0.0f; // CPU time in seconds to encode, submit, and present this window
+    float           presentTime         = 0.0f; // CPU time in seconds spent in Present() of this window
+    std::uint32_t   reserved            = 0;
+    std::uint64_t   uploadBytes         = 0;    // Bytes uploaded to the constant buffer in this frame; shared by all windows
+    std::uint64_t   memoryBytes         = 0;    // Live bytes of all resources and heap allocations of this window
+    std::uint64_t   totalMemoryBytes    = 0;    // Live bytes of all tracked resources and heap allocations
+};
+
+// Shared-memory ring buffer: one MetricsRingHeader followed by 'capacity' MetricsRecord entries.
+// The render loop is the only writer. Readers take 'writeIndex', then read records with a sequence lock:
+// a record is valid if its sequence is 2*(index + 1) both before and after copying its metrics.
+struct MetricsRingHeader
+{
+    std::uint32_t               magic;          // 'LGMX'
+    std::uint32_t               version;
+    std::uint32_t               capacity;       // Number of records
+    std::uint32_t               recordSize;     // Size of each MetricsRecord in bytes
+    std::atomic<std::uint64_t>  writeIndex;     // Total number of records that have been written
+};
+
+struct MetricsRecord
+{
+    std::atomic<std::uint64_t>  sequence;       // Odd while the record is being written
+    FrameMetrics                metrics;
+};
+
+// Publishes frame metrics to a shared-memory ring buffer and optionally serves the latest metrics per window
+// in Prometheus text format on a Unix-domain socket. Publish() never blocks the render loop: it only writes
+// to the ring, and the socket is served from a background thread that reads the ring like any other reader.
+class MetricsExporter
+{
+public:
+    static constexpr std::uint32_t magic    = 0x584D474C; // 'LGMX'
+    static constexpr std::uint32_t version  = 1;
+
+public:
+    static MetricsExporter& Get();
+
+    ~MetricsExporter();
+
+    // Creates the named shared-memory object for the ring buffer, e.g. "/llgl-example-metrics" on POSIX systems.
+    bool OpenSharedMemory(const char* name, std::uint32_t capacity = 1024);
+
+    // Starts serving Prometheus text format on the Unix-domain socket at the specified path.
+    // Without shared memory, the ring buffer is allocated in process memory.
+    bool OpenSocket(const char* path);
+
+    void Close();
+
+    void Publish(const FrameMetrics& metrics);
+
+    bool IsEnabled() const
+    {
+        return (header != nullptr);
+    }
+
+private:
+    MetricsExporter() = default;
+
+    bool CreateRing(std::uint32_t capacity, void* memory);
+
+    // Reads the latest record of each window with the reader protocol of the ring buffer.
+    std::string FormatPrometheusText() const;
+
+    void ServeSocket();
+
+private:
+    MetricsRingHeader*  header          = nullptr;
+    MetricsRecord*      records         = nullptr;
+    std::size_t         mappingSize     = 0;
+
+    void*               sharedMemory    = nullptr;  // Mapping of the shared-memory object; null if the ring is in process memory
+    void*               localMemory     = nullptr;
+    std::string         sharedMemoryName;
+    #ifdef _WIN32
+    void*               mappingHandle   = nullptr;
+    #endif
+
+    std::string         socketPath;
+    int                 socketFd        = -1;
+    std::thread         socketThread;
+    std::atomic<bool>   isSocketServing { false };
+};
+
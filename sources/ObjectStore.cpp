@@ -0,0 +1,207 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * ObjectStore.cpp
+ */
+
+#include "ObjectStore.h"
+#include <algorithm>
+#include <cmath>
+
+
+static constexpr float g_twoPi = 6.28318530718f;
+
+ObjectHandle ObjectStore::Create()
+{
+    if (size == capacity)
+        Reserve(std::max(64u, capacity * 2));
+
+    // Reuse a free slot so handle tables don't grow with churn
+    std::uint32_t slot;
+    if (!freeSlots.empty())
+    {
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+    }
+    else
+    {
+        slot = static_cast<std::uint32_t>(slotToIndex.size());
+        slotToIndex.push_back(0);
+        slotGenerations.push_back(0);
+    }
+
+    const std::uint32_t index = size++;
+    slotToIndex[slot] = index;
+    indexToSlot.push_back(slot);
+
+    positionX[index]    = 0.0f;
+    positionY[index]    = 0.0f;
+    positionZ[index]    = 0.0f;
+    axisX[index]        = 0.0f;
+    axisY[index]        = 1.0f;
+    axisZ[index]        = 0.0f;
+    angle[index]        = 0.0f;
+    speed[index]        = 0.0f;
+    colorR[index]       = 1.0f;
+    colorG[index]       = 1.0f;
+    colorB[index]       = 1.0f;
+    colorA[index]       = 1.0f;
+    UpdateWorldMatrices(index, index + 1);
+    bounds[index]       = AABB{};
+
+    ObjectHandle handle;
+    {
+        handle.slot         = slot;
+        handle.generation   = slotGenerations[slot];
+    }
+    return handle;
+}
+
+bool ObjectStore::Destroy(const ObjectHandle& handle)
+{
+    if (!IsValid(handle))
+        return false;
+
+    // Swap-remove: move the last object into the hole to keep the streams dense
+    const std::uint32_t index = slotToIndex[handle.slot];
+    const std::uint32_t last = size - 1;
+    if (index != last)
+    {
+        MoveObject(index, last);
+        const std::uint32_t lastSlot = indexToSlot[last];
+        slotToIndex[lastSlot] = index;
+        indexToSlot[index] = lastSlot;
+    }
+
+    indexToSlot.pop_back();
+    --size;
+
+    slotGenerations[handle.slot]++;
+    freeSlots.push_back(handle.slot);
+
+    return true;
+}
+
+void ObjectStore::Clear()
+{
+    // Invalidate all outstanding handles but keep the allocated streams
+    for (std::uint32_t slot : indexToSlot)
+    {
+        slotGenerations[slot]++;
+        freeSlots.push_back(slot);
+    }
+    indexToSlot.clear();
+    size = 0;
+}
+
+void ObjectStore::Reserve(std::uint32_t newCapacity)
+{
+    if (newCapacity <= capacity)
+        return;
+
+    positionX.Reserve(newCapacity);
+    positionY.Reserve(newCapacity);
+    positionZ.Reserve(newCapacity);
+    axisX.Reserve(newCapacity);
+    axisY.Reserve(newCapacity);
+    axisZ.Reserve(newCapacity);
+    angle.Reserve(newCapacity);
+    speed.Reserve(newCapacity);
+    colorR.Reserve(newCapacity);
+    colorG.Reserve(newCapacity);
+    colorB.Reserve(newCapacity);
+    colorA.Reserve(newCapacity);
+    worldMatrix.Reserve(newCapacity);
+    bounds.Reserve(newCapacity);
+
+    indexToSlot.reserve(newCapacity);
+
+    capacity = newCapacity;
+}
+
+bool ObjectStore::IsValid(const ObjectHandle& handle) const
+{
+    return (handle.slot < slotGenerations.size() && slotGenerations[handle.slot] == handle.generation && slotToIndex[handle.slot] < size && indexToSlot[slotToIndex[handle.slot]] == handle.slot);
+}
+
+std::uint32_t ObjectStore::GetIndex(const ObjectHandle& handle) const
+{
+    return (IsValid(handle) ? slotToIndex[handle.slot] : ~0u);
+}
+
+void ObjectStore::Animate(float deltaTime, std::uint32_t begin, std::uint32_t end)
+{
+    float* angles = angle.Data();
+    const float* speeds = speed.Data();
+
+    // Branch-free wrap-around so this loop vectorizes
+    for (std::uint32_t i = begin; i < end; ++i)
+    {
+        float a = angles[i] + speeds[i] * deltaTime;
+        a -= (a > g_twoPi ? g_twoPi : 0.0f);
+        a += (a < 0.0f ? g_twoPi : 0.0f);
+        angles[i] = a;
+    }
+}
+
+void ObjectStore::UpdateWorldMatrices(std::uint32_t begin, std::uint32_t end)
+{
+    for (std::uint32_t i = begin; i < end; ++i)
+    {
+        const float x = axisX[i];
+        const float y = axisY[i];
+        const float z = axisZ[i];
+
+        const float c  = std::cos(angle[i]);
+        const float s  = std::sin(angle[i]);
+        const float cc = 1.0f - c;
+
+        auto& m = worldMatrix[i];
+        m[0][0] = x*x*cc + c;
+        m[0][1] = y*x*cc + z*s;
+        m[0][2] = x*z*cc - y*s;
+        m[0][3] = 0.0f;
+
+        m[1][0] = x*y*cc - z*s;
+        m[1][1] = y*y*cc + c;
+        m[1][2] = y*z*cc + x*s;
+        m[1][3] = 0.0f;
+
+        m[2][0] = x*z*cc + y*s;
+        m[2][1] = y*z*cc - x*s;
+        m[2][2] = z*z*cc + c;
+        m[2][3] = 0.0f;
+
+        m[3][0] = positionX[i];
+        m[3][1] = positionY[i];
+        m[3][2] = positionZ[i];
+        m[3][3] = 1.0f;
+    }
+}
+
+void ObjectStore::UpdateBounds(const AABB& localBounds, std::uint32_t begin, std::uint32_t end)
+{
+    for (std::uint32_t i = begin; i < end; ++i)
+        bounds[i] = TransformAABB(localBounds, worldMatrix[i]);
+}
+
+void ObjectStore::MoveObject(std::uint32_t dst, std::uint32_t src)
+{
+    positionX[dst]  = positionX[src];
+    positionY[dst]  = positionY[src];
+    positionZ[dst]  = positionZ[src];
+    axisX[dst]      = axisX[src];
+    axisY[dst]      = axisY[src];
+    axisZ[dst]      = axisZ[src];
+    angle[dst]      = angle[src];
+    speed[dst]      = speed[src];
+    colorR[dst]     = colorR[src];
+    colorG[dst]     = colorG[src];
+    colorB[dst]     = colorB[src];
+    colorA[dst]     = colorA[src];
+    std::memcpy(worldMatrix[dst], worldMatrix[src], sizeof(worldMatrix[dst]));
+    bounds[dst]     = bounds[src];
+}
+
@@ -0,0 +1,134 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * ObjectStore.h
+ */
+
+#pragma once
+
+#include "BoundingVolumeHierarchy.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+
+// Growable array of trivially copyable elements whose storage starts at a cache line boundary.
+template <typename T>
+class AlignedArray
+{
+public:
+    static constexpr std::size_t alignment = 64;
+
+    void Reserve(std::size_t newCapacity)
+    {
+        if (newCapacity <= capacity)
+            return;
+
+        std::unique_ptr<char[]> newStorage{ new char[newCapacity * sizeof(T) + alignment - 1] };
+        const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(newStorage.get());
+        T* newData = reinterpret_cast<T*>((address + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1));
+
+        if (data != nullptr)
+            std::memcpy(newData, data, capacity * sizeof(T));
+
+        storage     = std::move(newStorage);
+        data        = newData;
+        capacity    = newCapacity;
+    }
+
+    T* Data()
+    {
+        return data;
+    }
+
+    const T* Data() const
+    {
+        return data;
+    }
+
+    T& operator [] (std::size_t index)
+    {
+        return data[index];
+    }
+
+    const T& operator [] (std::size_t index) const
+    {
+        return data[index];
+    }
+
+private:
+    std::unique_ptr<char[]> storage;
+    T*                      data        = nullptr;
+    std::size_t             capacity    = 0;
+};
+
+// Stable reference to an object in the ObjectStore; it becomes invalid when the object is destroyed.
+struct ObjectHandle
+{
+    std::uint32_t   slot        = ~0u;
+    std::uint32_t   generation  = 0;
+};
+
+// Dense structure-of-arrays storage for scene objects. Element i of each stream belongs to the same object,
+// so per-object loops stream through memory linearly. Destroying an object moves the last object into its place,
+// which changes dense indices but not handles.
+class ObjectStore
+{
+public:
+    ObjectHandle Create();
+    bool Destroy(const ObjectHandle& handle);
+    void Clear();
+    void Reserve(std::uint32_t capacity);
+
+    bool IsValid(const ObjectHandle& handle) const;
+
+    // Returns the current dense index of the object or ~0u if the handle is invalid.
+    std::uint32_t GetIndex(const ObjectHandle& handle) const;
+
+    std::uint32_t GetSize() const
+    {
+        return size;
+    }
+
+    // Advances the rotation angles of the objects in [begin, end).
+    void Animate(float deltaTime, std::uint32_t begin, std::uint32_t end);
+
+    // Builds the world matrices from position, rotation axis and angle for the objects in [begin, end).
+    void UpdateWorldMatrices(std::uint32_t begin, std::uint32_t end);
+
+    // Transforms the local bounds by the world matrices for the objects in [begin, end).
+    void UpdateBounds(const AABB& localBounds, std::uint32_t begin, std::uint32_t end);
+
+public:
+    // Dense streams; the size must only be changed with Create(), Destroy() and Clear()
+    AlignedArray<float>         positionX;
+    AlignedArray<float>         positionY;
+    AlignedArray<float>         positionZ;
+    AlignedArray<float>         axisX;          // Rotation axis; must be normalized
+    AlignedArray<float>         axisY;
+    AlignedArray<float>         axisZ;
+    AlignedArray<float>         angle;          // Rotation angle in radians
+    AlignedArray<float>         speed;          // Rotation speed in radians per second
+    AlignedArray<float>         colorR;
+    AlignedArray<float>         colorG;
+    AlignedArray<float>         colorB;
+    AlignedArray<float>         colorA;
+    AlignedArray<float[4][4]>   worldMatrix;    // Column-major, i.e. worldMatrix[i][column][row]
+    AlignedArray<AABB>          bounds;         // World space bounds
+
+private:
+    void MoveObject(std::uint32_t dst, std::uint32_t src);
+
+private:
+    std::uint32_t               size            = 0;
+    std::uint32_t               capacity        = 0;
+    std::vector<std::uint32_t>  slotToIndex;    // Dense index per handle slot
+    std::vector<std::uint32_t>  slotGenerations;
+    std::vector<std::uint32_t>  indexToSlot;    // Handle slot per dense index
+    std::vector<std::uint32_t>  freeSlots;
+};
+
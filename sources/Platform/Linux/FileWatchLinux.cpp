@@ -0,0 +1,73 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * FileWatchLinux.cpp
+ */
+
+#include "../Platform.h"
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <limits.h>
+
+
+static int g_inotifyFd = -1;
+
+bool PlatformWatchDirectory(const char* path)
+{
+    PlatformUnwatchDirectory();
+
+    g_inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (g_inotifyFd == -1)
+        return false;
+
+    // Editors either write the file in place or replace it by renaming a temporary file
+    if (inotify_add_watch(g_inotifyFd, path, IN_CLOSE_WRITE | IN_MOVED_TO) == -1)
+    {
+        PlatformUnwatchDirectory();
+        return false;
+    }
+
+    return true;
+}
+
+bool PlatformPollDirectoryChanges()
+{
+    if (g_inotifyFd == -1)
+        return false;
+
+    alignas(inotify_event) char buffer[sizeof(inotify_event) + NAME_MAX + 1];
+    bool hasChanged = false;
+
+    // Drain all pending events, so multiple writes of the same save only report a single change
+    for (;;)
+    {
+        const ssize_t size = read(g_inotifyFd, buffer, sizeof(buffer));
+        if (size <= 0)
+            break;
+
+        for (ssize_t offset = 0; offset < size;)
+        {
+            const inotify_event* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+
+            // Ignore hidden files, such as swap files of editors
+            if (event->len > 0 && event->name[0] != '.')
+                hasChanged = true;
+
+            offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+        }
+    }
+
+    return hasChanged;
+}
+
+void PlatformUnwatchDirectory()
+{
+    if (g_inotifyFd != -1)
+    {
+        close(g_inotifyFd);
+        g_inotifyFd = -1;
+    }
+}
+
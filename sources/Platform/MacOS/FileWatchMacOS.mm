@@ -0,0 +1,107 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * FileWatchMacOS.mm
+ */
+
+#include "../Platform.h"
+#include <sys/event.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <string>
+#include <vector>
+
+
+static int              g_kqueueFd = -1;
+static std::string      g_watchPath;
+static std::vector<int> g_watchFds;     // Directory followed by each file in it
+
+static void AddVnodeWatch(const std::string& path)
+{
+    const int fd = open(path.c_str(), O_EVTONLY);
+    if (fd == -1)
+        return;
+
+    struct kevent change;
+    EV_SET(&change, fd, EVFILT_VNODE, EV_ADD | EV_CLEAR, NOTE_WRITE | NOTE_EXTEND | NOTE_DELETE | NOTE_RENAME, 0, nullptr);
+    kevent(g_kqueueFd, &change, 1, nullptr, 0, nullptr);
+
+    g_watchFds.push_back(fd);
+}
+
+static void CloseVnodeWatches()
+{
+    for (int fd : g_watchFds)
+        close(fd);
+    g_watchFds.clear();
+}
+
+// kqueue watches file descriptors rather than paths, so files that are replaced on save must be opened again
+static void AddVnodeWatches()
+{
+    CloseVnodeWatches();
+
+    AddVnodeWatch(g_watchPath);
+
+    if (DIR* dir = opendir(g_watchPath.c_str()))
+    {
+        while (const dirent* entry = readdir(dir))
+        {
+            if (entry->d_type == DT_REG && entry->d_name[0] != '.')
+                AddVnodeWatch(g_watchPath + '/' + entry->d_name);
+        }
+        closedir(dir);
+    }
+}
+
+bool PlatformWatchDirectory(const char* path)
+{
+    PlatformUnwatchDirectory();
+
+    g_kqueueFd = kqueue();
+    if (g_kqueueFd == -1)
+        return false;
+
+    g_watchPath = path;
+    AddVnodeWatches();
+
+    return true;
+}
+
+bool PlatformPollDirectoryChanges()
+{
+    if (g_kqueueFd == -1)
+        return false;
+
+    const timespec timeout = { 0, 0 };
+    struct kevent events[16];
+    bool hasChanged = false;
+
+    // Drain all pending events, so multiple writes of the same save only report a single change
+    for (;;)
+    {
+        const int numEvents = kevent(g_kqueueFd, nullptr, 0, events, 16, &timeout);
+        if (numEvents <= 0)
+            break;
+        hasChanged = true;
+    }
+
+    if (hasChanged)
+        AddVnodeWatches();
+
+    return hasChanged;
+}
+
+void PlatformUnwatchDirectory()
+{
+    if (g_kqueueFd != -1)
+    {
+        CloseVnodeWatches();
+        close(g_kqueueFd);
+        g_kqueueFd = -1;
+    }
+}
+
@@ -14,3 +14,11 @@ void PlatformInit(LLGL::Surface& surface);
 void PlatformNewFrame(LLGL::Surface& surface);
 void PlatformShutdown();
 
+
+// Starts watching the files in the specified directory for changes. Returns false if this is not supported on the platform.
+bool PlatformWatchDirectory(const char* path);
+
+// Returns true if any file in the watched directory has been written since the last call. Never blocks.
+bool PlatformPollDirectoryChanges();
+
+void PlatformUnwatchDirectory();
@@ -0,0 +1,48 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * FileWatchWin32.cpp
+ */
+
+#include "../Platform.h"
+#include <Windows.h>
+
+
+static HANDLE g_changeHandle = INVALID_HANDLE_VALUE;
+
+bool PlatformWatchDirectory(const char* path)
+{
+    PlatformUnwatchDirectory();
+
+    g_changeHandle = FindFirstChangeNotificationA(path, FALSE, FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME);
+    return (g_changeHandle != INVALID_HANDLE_VALUE);
+}
+
+bool PlatformPollDirectoryChanges()
+{
+    if (g_changeHandle == INVALID_HANDLE_VALUE)
+        return false;
+
+    // Drain all pending notifications, so multiple writes of the same save only report a single change
+    bool hasChanged = false;
+    while (WaitForSingleObject(g_changeHandle, 0) == WAIT_OBJECT_0)
+    {
+        hasChanged = true;
+        if (!FindNextChangeNotification(g_changeHandle))
+            break;
+    }
+
+    return hasChanged;
+}
+
+void PlatformUnwatchDirectory()
+{
+    if (g_changeHandle != INVALID_HANDLE_VALUE)
+    {
+        FindCloseChangeNotification(g_changeHandle);
+        g_changeHandle = INVALID_HANDLE_VALUE;
+    }
+}
+
@@ -0,0 +1,76 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * PresentScheduler.cpp
+ */
+
+#include "PresentScheduler.h"
+#include <LLGL/LLGL.h>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+
+// Sleeping is coarse on most platforms, so the last part of the wait yields instead
+static constexpr double g_spinWaitTime = 0.001;
+
+void PresentScheduler::Reset(std::size_t numWindows)
+{
+    nextTicks.assign(numWindows, 0);
+}
+
+std::uint32_t PresentScheduler::GetVsyncInterval(PresentPolicy policy, bool isVsync, bool isPrimary)
+{
+    switch (policy)
+    {
+    case PresentPolicy::Sequential:
+        return (isVsync ? 1 : 0);
+    case PresentPolicy::PrimaryVsync:
+        return (isVsync && isPrimary ? 1 : 0);
+    case PresentPolicy::Independent:
+    default:
+        return 0;
+    }
+}
+
+bool PresentScheduler::IsDue(PresentPolicy policy, std::size_t windowIndex, std::uint64_t tick) const
+{
+    if (policy != PresentPolicy::Independent || windowIndex >= nextTicks.size())
+        return true;
+    return (tick >= nextTicks[windowIndex]);
+}
+
+void PresentScheduler::OnPresent(PresentPolicy policy, std::size_t windowIndex, std::uint64_t tick, float targetRate)
+{
+    if (policy != PresentPolicy::Independent || windowIndex >= nextTicks.size())
+        return;
+
+    const std::uint64_t period = static_cast<std::uint64_t>(static_cast<double>(LLGL::Timer::Frequency()) / std::max(1.0, static_cast<double>(targetRate)));
+
+    // Advance by whole periods to keep a steady cadence, but don't try to catch up on frames that were missed entirely
+    std::uint64_t& nextTick = nextTicks[windowIndex];
+    nextTick += period;
+    if (nextTick <= tick)
+        nextTick = tick + period;
+}
+
+void PresentScheduler::WaitForNextFrame(PresentPolicy policy) const
+{
+    if (policy != PresentPolicy::Independent || nextTicks.empty())
+        return;
+
+    const std::uint64_t dueTick = *std::min_element(nextTicks.begin(), nextTicks.end());
+    const double frequency = static_cast<double>(LLGL::Timer::Frequency());
+
+    for (std::uint64_t tick = LLGL::Timer::Tick(); tick < dueTick; tick = LLGL::Timer::Tick())
+    {
+        const double remainingTime = static_cast<double>(dueTick - tick) / frequency;
+        if (remainingTime > g_spinWaitTime)
+            std::this_thread::sleep_for(std::chrono::duration<double>(remainingTime - g_spinWaitTime));
+        else
+            std::this_thread::yield();
+    }
+}
+
@@ -0,0 +1,46 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * PresentScheduler.h
+ */
+
+#pragma once
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+
+enum class PresentPolicy
+{
+    Sequential,     // Every window presents with its own vsync setting; N vsynced windows run at 1/N of the display rate
+    PrimaryVsync,   // Only the first window that requests vsync waits for vertical blank, all others present immediately
+    Independent,    // No window waits for vertical blank; each window is paced to its own target rate by the CPU
+};
+
+// Decides when each swap chain is presented, so multiple vsynced windows don't block one after another.
+class PresentScheduler
+{
+public:
+    // Resets the timing of all windows, e.g. after the policy has changed.
+    void Reset(std::size_t numWindows);
+
+    // Returns the vsync interval the swap chain of a window must use under the specified policy.
+    // 'isPrimary' denotes the first window that requests vsync.
+    static std::uint32_t GetVsyncInterval(PresentPolicy policy, bool isVsync, bool isPrimary);
+
+    // Returns true if the window is due for a new frame. Always true unless the policy is PresentPolicy::Independent.
+    bool IsDue(PresentPolicy policy, std::size_t windowIndex, std::uint64_t tick) const;
+
+    // Schedules the next frame of the window after it has been presented.
+    void OnPresent(PresentPolicy policy, std::size_t windowIndex, std::uint64_t tick, float targetRate);
+
+    // Sleeps until the earliest window is due with PresentPolicy::Independent; returns immediately otherwise.
+    void WaitForNextFrame(PresentPolicy policy) const;
+
+private:
+    std::vector<std::uint64_t> nextTicks;   // Tick at which each window is due for its next frame
+};
+
@@ -0,0 +1,225 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * Simulation.cpp
+ */
+
+#include "Simulation.h"
+#include "ObjectStore.h"
+#include <LLGL/LLGL.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+
+static constexpr float          g_pi                    = 3.14159265f;
+static constexpr float          g_twoPi                 = 6.28318531f;
+
+// Advance() drops simulation time beyond this many steps per frame, so a long stall doesn't cause ever longer frames
+static constexpr std::uint32_t  g_maxStepsPerFrame      = 8;
+
+// The thread catches up on steps it missed by this many at most before it resynchronizes with the clock
+static constexpr std::uint64_t  g_maxCatchUpSteps       = 8;
+
+static float WrapAngle(float angle)
+{
+    angle -= (angle > g_twoPi ? g_twoPi : 0.0f);
+    angle += (angle < 0.0f ? g_twoPi : 0.0f);
+    return angle;
+}
+
+// Interpolates along the shorter arc, so an angle that wrapped around between both states doesn't spin backwards
+static float InterpolateAngle(float from, float to, float t)
+{
+    float delta = to - from;
+    delta -= (delta > g_pi ? g_twoPi : 0.0f);
+    delta += (delta < -g_pi ? g_twoPi : 0.0f);
+    return WrapAngle(from + delta * t);
+}
+
+Simulation::~Simulation()
+{
+    StopThread();
+}
+
+void Simulation::Reset(const ObjectStore& objects, const std::vector<float>& windowRotations)
+{
+    std::lock_guard<std::mutex> stepLock{ stepMutex };
+    std::lock_guard<std::mutex> stateLock{ stateMutex };
+
+    const std::uint32_t numObjects = objects.GetSize();
+    objectSpeeds.assign(objects.speed.Data(), objects.speed.Data() + numObjects);
+
+    for (State& state : states)
+    {
+        state.objectAngles.assign(objects.angle.Data(), objects.angle.Data() + numObjects);
+        state.windowRotations = windowRotations;
+    }
+
+    windowInputs.resize(windowRotations.size());
+    accumulator     = 0.0f;
+    lastStepTick    = LLGL::Timer::Tick();
+}
+
+void Simulation::SetAnimateObjects(bool animate)
+{
+    std::lock_guard<std::mutex> stateLock{ stateMutex };
+    animateObjects = animate;
+}
+
+void Simulation::SetWindowInput(std::size_t windowIndex, const WindowInput& input)
+{
+    std::lock_guard<std::mutex> stateLock{ stateMutex };
+    if (windowIndex < windowInputs.size())
+        windowInputs[windowIndex] = input;
+}
+
+void Simulation::SetStepRate(float rate)
+{
+    stepRate.store(std::max(1.0f, rate));
+}
+
+std::uint32_t Simulation::Advance(float frameTime)
+{
+    if (IsThreadRunning())
+        return 0;
+
+    const float stepTime = 1.0f / stepRate.load();
+
+    accumulator += frameTime;
+
+    std::uint32_t numStepsRun = 0;
+    while (accumulator >= stepTime && numStepsRun < g_maxStepsPerFrame)
+    {
+        Step();
+        accumulator -= stepTime;
+        ++numStepsRun;
+    }
+
+    if (accumulator >= stepTime)
+        accumulator = std::fmod(accumulator, stepTime);
+
+    return numStepsRun;
+}
+
+void Simulation::Interpolate(float* objectAngles, std::uint32_t numObjects, float* windowRotations, std::uint32_t numWindows)
+{
+    std::lock_guard<std::mutex> stateLock{ stateMutex };
+
+    const float t = GetInterpolationFactor();
+    const State& prev = states[prevIndex];
+    const State& curr = states[currIndex];
+
+    numObjects = std::min(numObjects, static_cast<std::uint32_t>(curr.objectAngles.size()));
+    for (std::uint32_t i = 0; i < numObjects; ++i)
+        objectAngles[i] = InterpolateAngle(prev.objectAngles[i], curr.objectAngles[i], t);
+
+    numWindows = std::min(numWindows, static_cast<std::uint32_t>(curr.windowRotations.size()));
+    for (std::uint32_t i = 0; i < numWindows; ++i)
+        windowRotations[i] = InterpolateAngle(prev.windowRotations[i], curr.windowRotations[i], t);
+}
+
+void Simulation::StartThread()
+{
+    if (IsThreadRunning())
+        return;
+
+    isQuit = false;
+    thread = std::thread(&Simulation::Run, this);
+}
+
+void Simulation::StopThread()
+{
+    if (!IsThreadRunning())
+        return;
+
+    isQuit = true;
+    thread.join();
+}
+
+void Simulation::Step()
+{
+    std::lock_guard<std::mutex> stepLock{ stepMutex };
+
+    bool animate = false;
+    {
+        std::lock_guard<std::mutex> stateLock{ stateMutex };
+        animate     = animateObjects;
+        stepInputs  = windowInputs;
+    }
+
+    const float stepTime = 1.0f / stepRate.load();
+
+    // The state indices only change under 'stepMutex', so the current and next state can be accessed without 'stateMutex'
+    const State& curr = states[currIndex];
+    State& next = states[nextIndex];
+
+    const std::size_t numObjects = curr.objectAngles.size();
+    next.objectAngles.resize(numObjects);
+    if (animate)
+    {
+        for (std::size_t i = 0; i < numObjects; ++i)
+            next.objectAngles[i] = WrapAngle(curr.objectAngles[i] + objectSpeeds[i] * stepTime);
+    }
+    else
+        std::copy(curr.objectAngles.begin(), curr.objectAngles.end(), next.objectAngles.begin());
+
+    const std::size_t numWindows = curr.windowRotations.size();
+    next.windowRotations.resize(numWindows);
+    for (std::size_t i = 0; i < numWindows; ++i)
+    {
+        const WindowInput& input = stepInputs[i];
+        if (input.isAuto)
+            next.windowRotations[i] = WrapAngle(curr.windowRotations[i] + input.rotateSpeed * stepTime * 10.0f);
+        else
+            next.windowRotations[i] = input.rotation;
+    }
+
+    {
+        std::lock_guard<std::mutex> stateLock{ stateMutex };
+        const int oldPrevIndex = prevIndex;
+        prevIndex       = currIndex;
+        currIndex       = nextIndex;
+        nextIndex       = oldPrevIndex;
+        lastStepTick    = LLGL::Timer::Tick();
+    }
+
+    ++numSteps;
+}
+
+void Simulation::Run()
+{
+    const double frequency = static_cast<double>(LLGL::Timer::Frequency());
+
+    std::uint64_t nextTick = LLGL::Timer::Tick();
+    while (!isQuit)
+    {
+        const std::uint64_t period = static_cast<std::uint64_t>(frequency / static_cast<double>(stepRate.load()));
+
+        const std::uint64_t tick = LLGL::Timer::Tick();
+        if (tick < nextTick)
+            std::this_thread::sleep_for(std::chrono::duration<double>(static_cast<double>(nextTick - tick) / frequency));
+
+        Step();
+
+        // Catch up after short delays to keep the step rate, but resynchronize after long stalls
+        nextTick += period;
+        const std::uint64_t now = LLGL::Timer::Tick();
+        if (now > nextTick + period * g_maxCatchUpSteps)
+            nextTick = now;
+    }
+}
+
+float Simulation::GetInterpolationFactor() const
+{
+    const float rate = stepRate.load();
+    if (IsThreadRunning())
+    {
+        const double elapsedTime = static_cast<double>(LLGL::Timer::Tick() - lastStepTick) / static_cast<double>(LLGL::Timer::Frequency());
+        return std::min(1.0f, static_cast<float>(elapsedTime) * rate);
+    }
+    return std::min(1.0f, accumulator * rate);
+}
+
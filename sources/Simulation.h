@@ -0,0 +1,109 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * Simulation.h
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+class ObjectStore;
+
+// Advances the rotation angles of the scene objects and windows in fixed time steps, so animation speed and results
+// don't depend on the frame rate. The last two states are kept and each frame interpolates between them, i.e. the
+// rendered state lags up to one step behind. Steps run either within Advance() or on a dedicated thread.
+class Simulation
+{
+public:
+    struct WindowInput
+    {
+        bool    isAuto      = true;     // Integrate the rotation; otherwise take it from 'rotation'
+        float   rotateSpeed = 0.0f;
+        float   rotation    = 0.0f;
+    };
+
+public:
+    ~Simulation();
+
+    // Takes over angles and speeds of all objects and the rotations of all windows, and discards the state history.
+    void Reset(const ObjectStore& objects, const std::vector<float>& windowRotations);
+
+    // Sets the input of the following steps.
+    void SetAnimateObjects(bool animate);
+    void SetWindowInput(std::size_t windowIndex, const WindowInput& input);
+
+    void SetStepRate(float rate);
+
+    // Runs all steps that are due after another 'frameTime' seconds; returns the number of steps that were run.
+    // Does nothing while the thread is running.
+    std::uint32_t Advance(float frameTime);
+
+    // Writes the state between the last two steps into the object angles and window rotations.
+    void Interpolate(float* objectAngles, std::uint32_t numObjects, float* windowRotations, std::uint32_t numWindows);
+
+    // Runs the steps on a dedicated thread at the step rate instead of within Advance().
+    void StartThread();
+    void StopThread();
+
+    bool IsThreadRunning() const
+    {
+        return thread.joinable();
+    }
+
+    float GetStepRate() const
+    {
+        return stepRate.load();
+    }
+
+    std::uint64_t GetNumSteps() const
+    {
+        return numSteps.load();
+    }
+
+private:
+    struct State
+    {
+        std::vector<float> objectAngles;
+        std::vector<float> windowRotations;
+    };
+
+private:
+    // Computes the next state from the current one and makes it current.
+    void Step();
+
+    void Run();
+
+    // Returns the interpolation factor between the previous and current state; 'stateMutex' must be locked.
+    float GetInterpolationFactor() const;
+
+private:
+    std::mutex                  stepMutex;                  // Held while a step is computed; excludes Reset()
+    std::mutex                  stateMutex;                 // Guards state indices, inputs, and step timing
+
+    State                       states[3];                  // Previous, current, and next state in turns
+    int                         prevIndex       = 0;
+    int                         currIndex       = 1;
+    int                         nextIndex       = 2;        // Only written by the step in progress
+
+    std::vector<float>          objectSpeeds;               // Rotation speed per object in radians per second
+    std::vector<WindowInput>    windowInputs;
+    std::vector<WindowInput>    stepInputs;                 // Copy of 'windowInputs' for the step in progress
+    bool                        animateObjects  = false;
+
+    std::atomic<float>          stepRate        { 60.0f };  // Steps per second
+    float                       accumulator     = 0.0f;     // Time in seconds not yet simulated by Advance()
+    std::uint64_t               lastStepTick    = 0;        // Tick of the last step on the thread
+    std::atomic<std::uint64_t>  numSteps        { 0 };
+
+    std::thread                 thread;
+    std::atomic<bool>           isQuit          { false };
+};
+
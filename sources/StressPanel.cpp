@@ -0,0 +1,402 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * StressPanel.cpp
+ */
+
+#include "StressPanel.h"
+#include "imgui.h"
+#include <LLGL/LLGL.h>
+#include <algorithm>
+#include <cfloat>
+#include <chrono>
+#include <cmath>
+
+
+// Number of events the queue can hold; must be a power of two
+static constexpr std::uint64_t g_queueCapacity = 1u << 18;
+
+// Time in milliseconds between two batches of the producer
+static constexpr int g_producerInterval = 1;
+
+static const char* g_severityNames[] = { "INFO", "WARN", "ERROR" };
+
+static float TicksToSeconds(std::uint64_t ticks)
+{
+    return static_cast<float>(static_cast<double>(ticks) / static_cast<double>(LLGL::Timer::Frequency()));
+}
+
+// Deterministic pseudo-random numbers, so each run produces the same data
+static std::uint32_t NextRandom(std::uint32_t& state)
+{
+    // Xorshift32
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+static float NextRandomFloat(std::uint32_t& state)
+{
+    return static_cast<float>(NextRandom(state) >> 8) / static_cast<float>(1u << 24);
+}
+
+StressPanel& StressPanel::Get()
+{
+    static StressPanel instance;
+    return instance;
+}
+
+StressPanel::~StressPanel()
+{
+    StopProducer();
+}
+
+void StressPanel::Reset(const Config& config)
+{
+    const bool wasProducing = IsProducing();
+    StopProducer();
+
+    this->config = config;
+
+    std::uint32_t random = 0x9E3779B9u;
+
+    rows.resize(config.numRows);
+    for (Row& row : rows)
+    {
+        row.value       = NextRandomFloat(random) * 100.0f;
+        row.delta       = 0.0f;
+        row.numUpdates  = 0;
+        row.lastFrame   = 0;
+    }
+
+    logLines.resize(std::max(1u, config.logCapacity));
+    for (std::size_t i = 0; i < logLines.size(); ++i)
+    {
+        logLines[i].sequence    = i;
+        logLines[i].severity    = NextRandom(random) % 3;
+        logLines[i].value       = NextRandomFloat(random);
+    }
+    numLogLines = logLines.size();
+
+    points.resize(std::max(1u, config.numPoints));
+    for (std::size_t i = 0; i < points.size(); ++i)
+        points[i] = std::sin(static_cast<float>(i) * 0.01f) + NextRandomFloat(random) * 0.2f;
+    numSamples = points.size();
+
+    if (queue.empty())
+    {
+        queue.resize(g_queueCapacity);
+        queueMask = g_queueCapacity - 1;
+    }
+    queueWritePos.store(0, std::memory_order_relaxed);
+    queueReadPos.store(0, std::memory_order_relaxed);
+    numDropped.store(0, std::memory_order_relaxed);
+
+    eventsPerSecond.store(config.eventsPerSecond, std::memory_order_relaxed);
+    frame = 0;
+
+    if (wasProducing)
+        StartProducer();
+}
+
+void StressPanel::StartProducer()
+{
+    if (IsProducing() || rows.empty())
+        return;
+
+    isQuit = false;
+    producerThread = std::thread(&StressPanel::RunProducer, this);
+}
+
+void StressPanel::StopProducer()
+{
+    if (!IsProducing())
+        return;
+
+    isQuit = true;
+    producerThread.join();
+}
+
+void StressPanel::Update()
+{
+    const std::uint64_t startTick = LLGL::Timer::Tick();
+
+    // Take all events that were published before this frame; later ones are applied in the next frame
+    const std::uint64_t readPos = queueReadPos.load(std::memory_order_relaxed);
+    const std::uint64_t writePos = queueWritePos.load(std::memory_order_acquire);
+
+    for (std::uint64_t pos = readPos; pos < writePos; ++pos)
+        ApplyEvent(queue[pos & queueMask]);
+
+    queueReadPos.store(writePos, std::memory_order_release);
+
+    numFrameEvents = static_cast<std::uint32_t>(writePos - readPos);
+    updateTime = TicksToSeconds(LLGL::Timer::Tick() - startTick);
+    ++frame;
+}
+
+void StressPanel::RunProducer()
+{
+    const std::uint32_t numRows = static_cast<std::uint32_t>(rows.size());
+    const double frequency = static_cast<double>(LLGL::Timer::Frequency());
+
+    std::uint32_t random = 0x2545F491u;
+    std::uint64_t numProduced = 0;
+    std::uint64_t numLogProduced = 0;
+    std::uint64_t lastTick = LLGL::Timer::Tick();
+    double budget = 0.0;
+
+    while (!isQuit)
+    {
+        // Produce the events that are due since the last batch; events the queue cannot take are dropped
+        const std::uint64_t tick = LLGL::Timer::Tick();
+        budget += static_cast<double>(tick - lastTick) / frequency * static_cast<double>(eventsPerSecond.load(std::memory_order_relaxed));
+        budget = std::min(budget, static_cast<double>(g_queueCapacity));
+        lastTick = tick;
+
+        for (; budget >= 1.0; budget -= 1.0)
+        {
+            // Most events update rows, some append log lines or plot samples
+            Event event;
+            const std::uint32_t kind = NextRandom(random) % 10;
+            if (kind < 7)
+            {
+                event.type  = Event::RowUpdate;
+                event.index = NextRandom(random) % numRows;
+                event.value = (NextRandomFloat(random) - 0.5f) * 2.0f;
+            }
+            else if (kind < 8)
+            {
+                event.type  = Event::LogLine;
+                event.index = NextRandom(random) % 3;
+                event.value = NextRandomFloat(random);
+                ++numLogProduced;
+            }
+            else
+            {
+                event.type  = Event::Sample;
+                event.value = std::sin(static_cast<float>(numProduced) * 0.001f) + NextRandomFloat(random) * 0.2f;
+            }
+
+            if (!PushEvent(event))
+                numDropped.fetch_add(1, std::memory_order_relaxed);
+            ++numProduced;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(g_producerInterval));
+    }
+}
+
+bool StressPanel::PushEvent(const Event& event)
+{
+    const std::uint64_t writePos = queueWritePos.load(std::memory_order_relaxed);
+    if (writePos - queueReadPos.load(std::memory_order_acquire) >= g_queueCapacity)
+        return false;
+
+    queue[writePos & queueMask] = event;
+    queueWritePos.store(writePos + 1, std::memory_order_release);
+    return true;
+}
+
+void StressPanel::ApplyEvent(const Event& event)
+{
+    switch (event.type)
+    {
+    case Event::RowUpdate:
+        {
+            Row& row = rows[event.index];
+            row.delta       = event.value;
+            row.value      += event.value;
+            row.lastFrame   = frame;
+            ++row.numUpdates;
+        }
+        break;
+
+    case Event::LogLine:
+        {
+            LogLine& line = logLines[numLogLines % logLines.size()];
+            line.sequence   = numLogLines++;
+            line.severity   = event.index;
+            line.value      = event.value;
+        }
+        break;
+
+    case Event::Sample:
+        points[numSamples++ % points.size()] = event.value;
+        break;
+    }
+}
+
+void StressPanel::ShowPanel(bool* isOpen)
+{
+    if (rows.empty())
+    {
+        Reset(config);
+        StartProducer();
+    }
+
+    const std::uint64_t startTick = LLGL::Timer::Tick();
+
+    ImGui::SetNextWindowSize(ImVec2{ 560.0f, 720.0f }, ImGuiCond_FirstUseEver);
+    if (ImGui::Begin("Stress Test", isOpen))
+    {
+        ImGui::SeparatorText("Producer");
+        {
+            bool isProducing = IsProducing();
+            if (ImGui::Checkbox("Running", &isProducing))
+            {
+                if (isProducing)
+                    StartProducer();
+                else
+                    StopProducer();
+            }
+
+            int rate = static_cast<int>(config.eventsPerSecond);
+            if (ImGui::SliderInt("Events/s", &rate, 1000, 2000000, "%d", ImGuiSliderFlags_Logarithmic))
+            {
+                config.eventsPerSecond = static_cast<std::uint32_t>(rate);
+                eventsPerSecond.store(config.eventsPerSecond, std::memory_order_relaxed);
+            }
+
+            // Resizing the dataset restarts it with deterministic contents
+            static const std::uint32_t rowCounts[] = { 1000, 10000, 100000, 1000000 };
+            int rowCountIndex = static_cast<int>(std::find(std::begin(rowCounts), std::end(rowCounts), config.numRows) - std::begin(rowCounts));
+            if (ImGui::Combo("Rows", &rowCountIndex, "1K\0" "10K\0" "100K\0" "1M\0\0") && rowCountIndex < IM_ARRAYSIZE(rowCounts))
+            {
+                Config newConfig = config;
+                newConfig.numRows = rowCounts[rowCountIndex];
+                Reset(newConfig);
+            }
+
+            ImGui::Text(
+                "%u events in last frame (%.2f ms), %llu dropped",
+                numFrameEvents, updateTime * 1000.0f, static_cast<unsigned long long>(numDropped.load(std::memory_order_relaxed))
+            );
+        }
+        ImGui::SeparatorText("Cost");
+        {
+            // Time of the previous frame, since the current one is still being built
+            ImGui::Text("Panel: %.3f ms", panelTime * 1000.0f);
+            ImGui::PlotLines(
+                "Panel (ms)",
+                panelHistory,
+                historySize,
+                static_cast<int>(numPanelFrames % historySize),
+                nullptr,
+                0.0f,
+                FLT_MAX,
+                ImVec2{ 0.0f, 40.0f }
+            );
+        }
+
+        if (ImGui::CollapsingHeader("Table", ImGuiTreeNodeFlags_DefaultOpen))
+            ShowTable();
+        if (ImGui::CollapsingHeader("Log", ImGuiTreeNodeFlags_DefaultOpen))
+            ShowLog();
+        if (ImGui::CollapsingHeader("Plot", ImGuiTreeNodeFlags_DefaultOpen))
+            ShowPlot();
+    }
+    ImGui::End();
+
+    panelTime = TicksToSeconds(LLGL::Timer::Tick() - startTick);
+    panelHistory[numPanelFrames % historySize] = panelTime * 1000.0f;
+    ++numPanelFrames;
+}
+
+void StressPanel::ShowTable()
+{
+    const ImGuiTableFlags flags = (ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY | ImGuiTableFlags_SizingFixedFit);
+    if (!ImGui::BeginTable("StressRows", 5, flags, ImVec2{ 0.0f, 260.0f }))
+        return;
+
+    ImGui::TableSetupScrollFreeze(0, 1);
+    ImGui::TableSetupColumn("Row");
+    ImGui::TableSetupColumn("Value", ImGuiTableColumnFlags_WidthStretch);
+    ImGui::TableSetupColumn("Delta");
+    ImGui::TableSetupColumn("Updates");
+    ImGui::TableSetupColumn("Age");
+    ImGui::TableHeadersRow();
+
+    // Only the visible rows are submitted, so the cost does not grow with the number of rows
+    ImGuiListClipper clipper;
+    clipper.Begin(static_cast<int>(rows.size()));
+    while (clipper.Step())
+    {
+        for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i)
+        {
+            const Row& row = rows[static_cast<std::size_t>(i)];
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn(); ImGui::Text("%d", i);
+            ImGui::TableNextColumn(); ImGui::Text("%.3f", row.value);
+            ImGui::TableNextColumn(); ImGui::Text("%+.3f", row.delta);
+            ImGui::TableNextColumn(); ImGui::Text("%u", row.numUpdates);
+            ImGui::TableNextColumn();
+            if (row.numUpdates > 0)
+                ImGui::Text("%u", frame - row.lastFrame);
+            else
+                ImGui::TextDisabled("-");
+        }
+    }
+
+    ImGui::EndTable();
+}
+
+void StressPanel::ShowLog()
+{
+    static const ImVec4 severityColors[] =
+    {
+        ImVec4{ 0.8f, 0.8f, 0.8f, 1.0f },
+        ImVec4{ 1.0f, 0.8f, 0.3f, 1.0f },
+        ImVec4{ 1.0f, 0.4f, 0.4f, 1.0f },
+    };
+
+    if (!ImGui::BeginChild("StressLog", ImVec2{ 0.0f, 200.0f }, 1, ImGuiWindowFlags_HorizontalScrollbar))
+    {
+        ImGui::EndChild();
+        return;
+    }
+
+    // Lines are formatted only when they are visible; the oldest line that is still kept comes first
+    const std::uint64_t numKept = std::min<std::uint64_t>(numLogLines, logLines.size());
+    const std::uint64_t firstLine = numLogLines - numKept;
+
+    ImGuiListClipper clipper;
+    clipper.Begin(static_cast<int>(numKept));
+    while (clipper.Step())
+    {
+        for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i)
+        {
+            const LogLine& line = logLines[(firstLine + static_cast<std::uint64_t>(i)) % logLines.size()];
+            ImGui::TextColored(
+                severityColors[line.severity],
+                "[%08llu] %-5s sensor reading %.4f",
+                static_cast<unsigned long long>(line.sequence), g_severityNames[line.severity], line.value
+            );
+        }
+    }
+
+    // Keep following new lines while the log is scrolled to the bottom
+    if (ImGui::GetScrollY() >= ImGui::GetScrollMaxY())
+        ImGui::SetScrollHereY(1.0f);
+
+    ImGui::EndChild();
+}
+
+void StressPanel::ShowPlot()
+{
+    // ImGui samples the values down to the width of the plot, so the cost grows with the width rather than the number of points
+    ImGui::PlotLines(
+        "Samples",
+        points.data(),
+        static_cast<int>(points.size()),
+        static_cast<int>(numSamples % points.size()),
+        nullptr,
+        -1.5f,
+        1.5f,
+        ImVec2{ 0.0f, 160.0f }
+    );
+}
+
@@ -0,0 +1,128 @@
+/*
+ * LLGL Example ImGui
+ * Created on 02/22/2025 by L.Hermanns
+ * Published under the BSD-3 Clause License
+ * ----------------------------------------
+ * StressPanel.h
+ */
+
+#pragma once
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <cstdint>
+
+
+// Data-heavy GUI workload to measure the CPU cost of ImGui as the data grows: a table with up to a million rows,
+// a scrolling log, and a plot with 100k points. Table and log are virtualized with ImGuiListClipper, so their cost
+// only depends on the visible rows. A producer thread streams row updates, log lines, and plot samples through a
+// lock-free single-producer single-consumer queue, and the GUI thread applies them once per frame with Update().
+// The producer is seeded with a constant, so the same rate produces the same stream of events in every run.
+class StressPanel
+{
+public:
+    struct Config
+    {
+        std::uint32_t   numRows         = 1000000;
+        std::uint32_t   logCapacity     = 100000;   // Log lines beyond this number overwrite the oldest ones
+        std::uint32_t   numPoints       = 100000;
+        std::uint32_t   eventsPerSecond = 100000;
+    };
+
+    static constexpr int historySize = 120;
+
+public:
+    static StressPanel& Get();
+
+    ~StressPanel();
+
+    // Fills the dataset with deterministic contents for the configuration; restarts the producer if it was running.
+    void Reset(const Config& config);
+
+    void StartProducer();
+    void StopProducer();
+
+    bool IsProducing() const
+    {
+        return producerThread.joinable();
+    }
+
+    // Applies all queued events to the dataset; must be called once per frame before the GUI is built.
+    void Update();
+
+    // Shows the panel in the current ImGui context. Fills the dataset and starts the producer the first time.
+    void ShowPanel(bool* isOpen);
+
+private:
+    struct Event
+    {
+        enum Type : std::uint8_t
+        {
+            RowUpdate = 0,
+            LogLine,
+            Sample,
+        };
+
+        Type            type    = RowUpdate;
+        std::uint32_t   index   = 0;    // Row index for row updates, severity for log lines
+        float           value   = 0.0f;
+    };
+
+    struct Row
+    {
+        float           value       = 0.0f;
+        float           delta       = 0.0f;     // Change of the last update
+        std::uint32_t   numUpdates  = 0;
+        std::uint32_t   lastFrame   = 0;        // Frame of the last update
+    };
+
+    struct LogLine
+    {
+        std::uint64_t   sequence    = 0;
+        std::uint32_t   severity    = 0;
+        float           value       = 0.0f;
+    };
+
+private:
+    StressPanel() = default;
+
+    // Generates events at the configured rate until the producer is stopped; runs on the producer thread.
+    void RunProducer();
+
+    // Pushes the event into the queue; returns false if the queue is full. Only called by the producer thread.
+    bool PushEvent(const Event& event);
+
+    void ApplyEvent(const Event& event);
+
+    void ShowTable();
+    void ShowLog();
+    void ShowPlot();
+
+private:
+    Config                      config;
+    std::vector<Row>            rows;
+    std::vector<LogLine>        logLines;               // Ring buffer of the last 'logCapacity' lines
+    std::uint64_t               numLogLines     = 0;    // Total number of lines, including overwritten ones
+    std::vector<float>          points;                 // Ring buffer of plot samples
+    std::uint64_t               numSamples      = 0;
+    std::uint32_t               frame           = 0;
+
+    std::vector<Event>          queue;
+    std::uint64_t               queueMask       = 0;
+    alignas(64) std::atomic<std::uint64_t> queueWritePos { 0 };     // Written by the producer only
+    alignas(64) std::atomic<std::uint64_t> queueReadPos  { 0 };     // Written by the consumer only
+    alignas(64) std::atomic<std::uint64_t> numDropped    { 0 };     // Events lost because the queue was full
+
+    std::thread                 producerThread;
+    std::atomic<bool>           isQuit          { false };
+    std::atomic<std::uint32_t>  eventsPerSecond { 0 };
+
+    // Statistics of the GUI thread
+    std::uint32_t               numFrameEvents  = 0;    // Events applied in the last Update()
+    float                       updateTime      = 0.0f; // CPU time in seconds of the last Update()
+    float                       panelTime       = 0.0f; // CPU time in seconds to build the panel the last time
+    float                       panelHistory[historySize] = {};
+    std::uint64_t               numPanelFrames  = 0;
+};
+